@@ -62,11 +62,22 @@ This uses the non-sqrt version of the decomposition
 giving symmetric M = L*D*L.T() where the diagonal of L contains ones
 @param Size the size of the matrix
 @param Precision the precision of the entries in the matrix and its decomposition
+@param Layout the layout of the matrix used to store the decomposition. Use Bounded<N> with Size=Dynamic, or Stack
+with a large static Size, to avoid the heap: the results of backsub() etc then use the same storage.
 **/
-template <int Size=Dynamic, class Precision=DefaultPrecision>
+template <int Size=Dynamic, class Precision=DefaultPrecision, class Layout=RowMajor>
 class Cholesky {
+	typedef typename Internal::VectorResultBase<Size, Internal::MatrixCapacity<Layout>::rows, Internal::StorageOf<Layout>::value>::type VecBase;
+
+	template<int C2, class B2> struct MatrixResult
+	{
+		typedef Matrix<Size, C2, Precision, typename Internal::MatrixResultBase<Size, C2, Internal::MatrixCapacity<Layout>::rows, Internal::MatrixCapacity<B2>::cols, Internal::CombinedStorage<Layout, B2>::value>::type> type;
+	};
+
 public:
-	Cholesky(){}
+	///Construct an empty decomposition, for static sizes only. This is a
+	///template so that it is only instantiated when used.
+	template<class Dummy=void> Cholesky(){}
 
     /// Construct the Cholesky decomposition of a matrix. This initialises the class, and
     /// performs the decomposition immediately.
@@ -78,6 +89,24 @@ public:
 		do_compute();
 	}
 	
+	/// Construct the decomposition of a temporary matrix, such as
+	/// <code>Cholesky<> c(A + lambda * A.diagonal_slice().as_diagonal())</code>.
+	/// The storage of the temporary is reused rather than copied.
+	Cholesky(Matrix<Size, Size, Precision, Layout>&& m)
+		: my_cholesky(std::move(m)) {
+		SizeMismatch<Size,Size>::test(my_cholesky.num_rows(), my_cholesky.num_cols());
+		do_compute();
+	}
+
+	/// Construct the decomposition of a symmetric matrix, without forming the
+	/// full matrix first.
+	template<class P2>
+	Cholesky(const SymmetricMatrix<Size, P2>& m)
+		: my_cholesky(m.size(), m.size()) {
+		m.copy_lower(my_cholesky);
+		do_compute();
+	}
+
 	/// Constructor for Size=Dynamic
 	Cholesky(int size) : my_cholesky(size,size) {}
 
@@ -90,10 +119,28 @@ public:
 		my_cholesky=m;
 		do_compute();
 	}
+
+    /// Compute the LDL^T decomposition of a temporary matrix, reusing its
+    /// storage if possible.
+    /// Run time is O(N^3)
+	void compute(Matrix<Size, Size, Precision, Layout>&& m){
+		SizeMismatch<Size,Size>::test(m.num_rows(), m.num_cols());
+		SizeMismatch<Size,Size>::test(m.num_rows(), my_cholesky.num_rows());
+		my_cholesky=std::move(m);
+		do_compute();
+	}
+
+    /// Compute the LDL^T decomposition of a symmetric matrix.
+    /// Run time is O(N^3)
+	template<class P2> void compute(const SymmetricMatrix<Size, P2>& m){
+		m.copy_lower(my_cholesky);
+		do_compute();
+	}
 	
 	private:
 	void do_compute() {
 		int size=my_cholesky.num_rows();
+		TOON_INSTRUMENT_TIMED_OPERATION("Cholesky", size*(double)size*size/3);
 		for(int col=0; col<size; col++){
 			Precision inv_diag = 1;
 			for(int row=col; row < size; row++){
@@ -127,12 +174,12 @@ public:
 	/// Compute x = A^-1*v
     /// Run time is O(N^2)
 	template<int Size2, class P2, class B2>
-	Vector<Size, Precision> backsub (const Vector<Size2, P2, B2>& v) const {
+	Vector<Size, Precision, VecBase> backsub (const Vector<Size2, P2, B2>& v) const {
 		int size=my_cholesky.num_rows();
 		SizeMismatch<Size,Size2>::test(size, v.size());
 
 		// first backsub through L
-		Vector<Size, Precision> y(size);
+		Vector<Size, Precision, VecBase> y(size);
 		for(int i=0; i<size; i++){
 			Precision val = v[i];
 			for(int j=0; j<i; j++){
@@ -147,7 +194,7 @@ public:
 		}
 
 		// backsub through L.T()
-		Vector<Size,Precision> result(size);
+		Vector<Size,Precision,VecBase> result(size);
 		for(int i=size-1; i>=0; i--){
 			Precision val = y[i];
 			for(int j=i+1; j<size; j++){
@@ -162,18 +209,24 @@ public:
 	/**overload
 	*/
 	template<int Size2, int C2, class P2, class B2>
-	Matrix<Size, C2, Precision> backsub (const Matrix<Size2, C2, P2, B2>& m) const {
+	typename MatrixResult<C2, B2>::type backsub (const Matrix<Size2, C2, P2, B2>& m) const {
 		int size=my_cholesky.num_rows();
 		SizeMismatch<Size,Size2>::test(size, m.num_rows());
 
 		// first backsub through L
-		Matrix<Size, C2, Precision> y(size, m.num_cols());
+		// (a row at a time, so that the right hand sides are read along rows)
+		const int cols=m.num_cols();
+		typename MatrixResult<C2, B2>::type y(size, cols);
 		for(int i=0; i<size; i++){
-			Vector<C2, Precision> val = m[i];
+			for(int c=0; c<cols; c++){
+				y(i,c)=m(i,c);
+			}
 			for(int j=0; j<i; j++){
-				val -= my_cholesky(i,j)*y[j];
+				const Precision l = my_cholesky(i,j);
+				for(int c=0; c<cols; c++){
+					y(i,c) -= l*y(j,c);
+				}
 			}
-			y[i]=val;
 		}
 		
 		// backsub through diagonal
@@ -182,13 +235,17 @@ public:
 		}
 
 		// backsub through L.T()
-		Matrix<Size,C2,Precision> result(size, m.num_cols());
+		typename MatrixResult<C2, B2>::type result(size, cols);
 		for(int i=size-1; i>=0; i--){
-			Vector<C2,Precision> val = y[i];
+			for(int c=0; c<cols; c++){
+				result(i,c)=y(i,c);
+			}
 			for(int j=i+1; j<size; j++){
-				val -= my_cholesky(j,i)*result[j];
+				const Precision l = my_cholesky(j,i);
+				for(int c=0; c<cols; c++){
+					result(i,c) -= l*result(j,c);
+				}
 			}
-			result[i]=val;
 		}
 		return result;
 	}
@@ -197,13 +254,13 @@ public:
     /// Compute A^-1 and store in M
     /// Run time is O(N^3)
 	// easy way to get inverse - could be made more efficient
-	Matrix<Size,Size,Precision> get_inverse(){
-		Matrix<Size,Size,Precision>I(Identity(my_cholesky.num_rows()));
+	Matrix<Size,Size,Precision,Layout> get_inverse(){
+		Matrix<Size,Size,Precision,Layout>I(Identity(my_cholesky.num_rows()));
 		return backsub(I);
 	}
 	
 	///Compute the determinant.
-	Precision determinant(){
+	Precision determinant() const {
 		Precision answer=my_cholesky(0,0);
 		for(int i=1; i<my_cholesky.num_rows(); i++){
 			answer*=my_cholesky(i,i);
@@ -216,8 +273,8 @@ public:
 		return v * backsub(v);
 	}
 
-	Matrix<Size,Size,Precision> get_unscaled_L() const {
-		Matrix<Size,Size,Precision> m(my_cholesky.num_rows(),
+	Matrix<Size,Size,Precision,Layout> get_unscaled_L() const {
+		Matrix<Size,Size,Precision,Layout> m(my_cholesky.num_rows(),
 					      my_cholesky.num_rows());
 		m=Identity;
 		for (int i=1;i<my_cholesky.num_rows();i++) {
@@ -228,8 +285,8 @@ public:
 		return m;
 	}
 			
-	Matrix<Size,Size,Precision> get_D() const {
-		Matrix<Size,Size,Precision> m(my_cholesky.num_rows(),
+	Matrix<Size,Size,Precision,Layout> get_D() const {
+		Matrix<Size,Size,Precision,Layout> m(my_cholesky.num_rows(),
 					      my_cholesky.num_rows());
 		m=Zeros;
 		for (int i=0;i<my_cholesky.num_rows();i++) {
@@ -238,9 +295,9 @@ public:
 		return m;
 	}
 	
-	Matrix<Size,Size,Precision> get_L() const {
+	Matrix<Size,Size,Precision,Layout> get_L() const {
 		using std::sqrt;
-		Matrix<Size,Size,Precision> m(my_cholesky.num_rows(),
+		Matrix<Size,Size,Precision,Layout> m(my_cholesky.num_rows(),
 					      my_cholesky.num_rows());
 		m=Zeros;
 		for (int j=0;j<my_cholesky.num_cols();j++) {
@@ -256,7 +313,7 @@ public:
 	int rank() const { return my_rank; }
 
 private:
-	Matrix<Size,Size,Precision> my_cholesky;
+	Matrix<Size,Size,Precision,Layout> my_cholesky;
 	int my_rank;
 };
 
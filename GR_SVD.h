@@ -145,6 +145,7 @@ namespace TooN
   template<class Precision2, class Base> 
   GR_SVD<M, N, Precision, WANT_U, WANT_V>::GR_SVD(const Matrix<M, N, Precision2, Base> &mA)
   {
+    TOON_INSTRUMENT_TIMED_OPERATION("GR_SVD", 4.0*BigDim*SmallDim*SmallDim + 8.0*SmallDim*SmallDim*SmallDim);
     nError = 0;
     mU = mA; 
     Bidiagonalize();
@@ -61,10 +61,16 @@ It can be used as follows to solve the \f$M\underline{x} = \underline{c}\f$ prob
 @endcode
 The convention LU<> (=LU<-1>) is used to create an LU decomposition whose size is 
 determined at runtime.
+
+The Layout parameter is the layout of the matrix used to store the decomposition. Use Bounded<N> with
+Size=Dynamic, or Stack with a large static Size, to avoid the heap: the results of backsub() etc then use the
+same storage.
 @ingroup gDecomps
 **/
-template <int Size=-1, class Precision=double>
+template <int Size=-1, class Precision=double, class Layout=RowMajor>
 class LU {
+	typedef typename Internal::VectorResultBase<Size, Internal::MatrixCapacity<Layout>::rows, Internal::StorageOf<Layout>::value>::type VecBase;
+
 	public:
 
 	/// Construct the %LU decomposition of a matrix. This initialises the class, and
@@ -82,6 +88,8 @@ class LU {
 		SizeMismatch<Size, S1>::test(my_lu.num_rows(),m.num_rows());
 		SizeMismatch<Size, S2>::test(my_lu.num_rows(),m.num_cols());
 	
+		TOON_INSTRUMENT_TIMED_OPERATION("LU", 2*m.num_rows()*(double)m.num_rows()*m.num_rows()/3);
+
 		//Make a local copy. This is guaranteed contiguous
 		my_lu=m;
 		FortranInteger lda = m.num_rows();
@@ -98,11 +106,11 @@ class LU {
 	/// Calculate result of multiplying the inverse of M by another matrix. For a matrix \f$A\f$, this
 	/// calculates \f$M^{-1}A\f$ by back substitution (i.e. without explictly calculating the inverse).
 	template <int Rows, int NRHS, class Base>
-	Matrix<Size,NRHS,Precision> backsub(const Matrix<Rows,NRHS,Precision,Base>& rhs){
+	Matrix<Size,NRHS,Precision,typename Internal::MatrixResultBase<Size, NRHS, Internal::MatrixCapacity<Layout>::rows, Internal::MatrixCapacity<Base>::cols, Internal::CombinedStorage<Layout, Base>::value>::type> backsub(const Matrix<Rows,NRHS,Precision,Base>& rhs){
 		//Check the number of rows is OK.
 		SizeMismatch<Size, Rows>::test(my_lu.num_rows(), rhs.num_rows());
 	
-		Matrix<Size, NRHS, Precision> result(rhs);
+		Matrix<Size, NRHS, Precision, typename Internal::MatrixResultBase<Size, NRHS, Internal::MatrixCapacity<Layout>::rows, Internal::MatrixCapacity<Base>::cols, Internal::CombinedStorage<Layout, Base>::value>::type> result(rhs);
 
 		FortranInteger M=rhs.num_cols();
 		FortranInteger N=my_lu.num_rows();
@@ -127,11 +135,11 @@ class LU {
 	/// Calculate result of multiplying the inverse of M by a vector. For a vector \f$b\f$, this
 	/// calculates \f$M^{-1}b\f$ by back substitution (i.e. without explictly calculating the inverse).
 	template <int Rows, class Base>
-	Vector<Size,Precision> backsub(const Vector<Rows,Precision,Base>& rhs){
+	Vector<Size,Precision,VecBase> backsub(const Vector<Rows,Precision,Base>& rhs){
 		//Check the number of rows is OK.
 		SizeMismatch<Size, Rows>::test(my_lu.num_rows(), rhs.size());
 	
-		Vector<Size, Precision> result(rhs);
+		Vector<Size, Precision, VecBase> result(rhs);
 
 		FortranInteger M=1;
 		FortranInteger N=my_lu.num_rows();
@@ -153,17 +161,24 @@ class LU {
 
 	/// Calculate inverse of the matrix. This is not usually needed: if you need the inverse just to 
 	/// multiply it by a matrix or a vector, use one of the backsub() functions, which will be faster.
-	Matrix<Size,Size,Precision> get_inverse(){
-		Matrix<Size,Size,Precision> Inverse(my_lu);
+	Matrix<Size,Size,Precision,Layout> get_inverse(){
+		Matrix<Size,Size,Precision,Layout> Inverse(my_lu);
 		FortranInteger N = my_lu.num_rows();
 		FortranInteger lda=my_lu.num_rows();
-		FortranInteger lwork=-1;
-		Precision size;
-		getri_(&N, &Inverse[0][0], &lda, &my_IPIV[0], &size, &lwork, &my_info);
-		lwork=FortranInteger(size);
-		Precision* WORK = new Precision[lwork];
-		getri_(&N, &Inverse[0][0], &lda, &my_IPIV[0], WORK, &lwork, &my_info);
-		delete [] WORK;
+		if(Internal::MatrixCapacity<Layout>::rows != 0){
+			//Bounded: use the minimum workspace, which fits in the capacity.
+			FortranInteger lwork=N;
+			Vector<Size, Precision, VecBase> WORK(N);
+			getri_(&N, &Inverse[0][0], &lda, &my_IPIV[0], &WORK[0], &lwork, &my_info);
+		} else {
+			FortranInteger lwork=-1;
+			Precision size;
+			getri_(&N, &Inverse[0][0], &lda, &my_IPIV[0], &size, &lwork, &my_info);
+			lwork=FortranInteger(size);
+			Precision* WORK = new Precision[lwork];
+			getri_(&N, &Inverse[0][0], &lda, &my_IPIV[0], WORK, &lwork, &my_info);
+			delete [] WORK;
+		}
 		return Inverse;
 	}
 
@@ -172,7 +187,7 @@ class LU {
 	/// and U is upper-triangular, these are returned conflated into one matrix, where the 
 	/// diagonal and above parts of the matrix are U and the below-diagonal part, plus a unit diagonal, 
 	/// are L.
-	const Matrix<Size,Size,Precision>& get_lu()const {return my_lu;}
+	const Matrix<Size,Size,Precision,Layout>& get_lu()const {return my_lu;}
 	
 	private:
 	inline int get_sign() const {
@@ -200,9 +215,9 @@ class LU {
 
  private:
 
-	Matrix<Size,Size,Precision> my_lu;
+	Matrix<Size,Size,Precision,Layout> my_lu;
 	FortranInteger my_info;
-	Vector<Size, FortranInteger> my_IPIV;	//Convenient static-or-dynamic array of ints :-)
+	Vector<Size, FortranInteger, VecBase> my_IPIV;	//Convenient static-or-dynamic array of ints :-)
 
 };
 }
@@ -93,6 +93,7 @@ public:
 
 	void do_compute(){
 		FortranInteger N = my_cholesky.num_rows();
+		TOON_INSTRUMENT_TIMED_OPERATION("Lapack_Cholesky", N*(double)N*N/3);
 		FortranInteger info;
 		potrf_("L", &N, my_cholesky_lapack.my_data, &N, &info);
 		for (int i=0;i<N;i++) {
@@ -114,6 +114,7 @@ template<int Rows=Dynamic, int Cols=Rows, typename Precision=double> class QR
 
 		void compute()
 		{
+			TOON_INSTRUMENT_TIMED_OPERATION("QR", 2.0*m.num_rows()*m.num_cols()*m.num_cols() - 2.0*m.num_cols()*m.num_cols()*m.num_cols()/3);
 			
 			//QR decomposition makes use of Householder reflections.
 			// A = QR, 
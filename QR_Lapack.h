@@ -101,6 +101,7 @@ class QR_Lapack{
 		{	
 			FortranInteger M = copy.num_rows();
 			FortranInteger N = copy.num_cols();
+			TOON_INSTRUMENT_TIMED_OPERATION("QR_Lapack", 2.0*M*N*N - 2.0*N*N*N/3);
 			
 			FortranInteger LWORK=-1;
 			FortranInteger INFO;
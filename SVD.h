@@ -90,8 +90,9 @@ class SVD {
 	
 public:
 
-	/// default constructor for Rows>0 and Cols>0
-	SVD() {}
+	/// default constructor for Rows>0 and Cols>0. This is a template
+	/// so that it is only instantiated when used.
+	template<class Dummy=void> SVD() {}
 
 	/// constructor for Rows=-1 or Cols=-1 (or both)
 	SVD(int rows, int cols)
@@ -124,6 +125,7 @@ public:
 		int lda = my_copy.num_cols();
 		int m = my_copy.num_cols();
 		int n = my_copy.num_rows();
+		TOON_INSTRUMENT_TIMED_OPERATION("SVD", 4.0*std::max(m,n)*std::min(m,n)*std::min(m,n) + 8.0*std::min(m,n)*std::min(m,n)*std::min(m,n));
 		Precision* const uorvt = my_square.my_data;
 		Precision* const s = my_diagonal.my_data;
 		int ldu;
@@ -59,11 +59,11 @@ namespace Internal{
 		///@param m Input matrix (assumed to be symmetric)
 		///@param evectors Eigen vector output
 		///@param evalues Eigen values output
-		template<int Rows, int Cols, typename P, typename B>
-		static inline void compute(const Matrix<Rows,Cols,P, B>& m, Matrix<Size,Size,P> & evectors, Vector<Size, P>& evalues) {
+		template<int Rows, int Cols, typename P, typename B, typename EB, typename VB>
+		static inline void compute(const Matrix<Rows,Cols,P, B>& m, Matrix<Size,Size,P,EB> & evectors, Vector<Size, P, VB>& evalues) {
 
-			SizeMismatch<Rows, Cols>::test(m.num_rows(), m.num_cols());	 //m must be square
-			SizeMismatch<Size, Rows>::test(m.num_rows(), evalues.size()); //m must be the size of the system
+			::TooN::SizeMismatch<Rows, Cols>::test(m.num_rows(), m.num_cols());	 //m must be square
+			::TooN::SizeMismatch<Size, Rows>::test(m.num_rows(), evalues.size()); //m must be the size of the system
 			
 
 			evectors = m;
@@ -71,12 +71,19 @@ namespace Internal{
 			FortranInteger lda = evalues.size();
 			FortranInteger info;
 			FortranInteger lwork=-1;
-			P size;
 
-			// find out how much space fortran needs
-			syev_((char*)"V",(char*)"U",&N,&evectors[0][0],&lda,&evalues[0], &size,&lwork,&info);
-			lwork = int(size);
-			Vector<Dynamic, P> WORK(lwork);
+			//Bounded decompositions use the minimum workspace, which fits in the capacity.
+			const int cap = MatrixCapacity<EB>::rows;
+			if(cap != 0){
+				lwork = std::max<FortranInteger>(1, 3*N-1);
+			} else {
+				P size;
+
+				// find out how much space fortran needs
+				syev_((char*)"V",(char*)"U",&N,&evectors[0][0],&lda,&evalues[0], &size,&lwork,&info);
+				lwork = int(size);
+			}
+			Vector<Dynamic, P, typename VectorResultBase<Dynamic, 3*cap>::type> WORK(lwork);
 
 			// now compute the decomposition
 			syev_((char*)"V",(char*)"U",&N,&evectors[0][0],&lda,&evalues[0], &WORK[0],&lwork,&info);
@@ -100,8 +107,8 @@ namespace Internal{
 		///@param m Input matrix (assumed to be symmetric)
 		///@param eig Eigen vector output
 		///@param ev Eigen values output
-		template<typename P, typename B>
-		static inline void compute(const Matrix<2,2,P,B>& m, Matrix<2,2,P>& eig, Vector<2, P>& ev) {
+		template<typename P, typename B, typename EB, typename VB>
+		static inline void compute(const Matrix<2,2,P,B>& m, Matrix<2,2,P,EB>& eig, Vector<2, P, VB>& ev) {
 			double trace = m[0][0] + m[1][1];
 			//Only use the upper triangular elements.
 			double det = m[0][0]*m[1][1] - m[0][1]*m[0][1]; 
@@ -143,8 +150,8 @@ namespace Internal{
 		///@param m Input matrix (assumed to be symmetric)
 		///@param eig Eigen vector output
 		///@param ev Eigen values output
-		template<typename P, typename B>
-		static inline void compute(const Matrix<3,3,P,B>& m, Matrix<3,3,P>& eig, Vector<3, P>& ev) {
+		template<typename P, typename B, typename EB, typename VB>
+		static inline void compute(const Matrix<3,3,P,B>& m, Matrix<3,3,P,EB>& eig, Vector<3, P, VB>& ev) {
             //method uses closed form solution of cubic equation to obtain roots of characteristic equation.
             using std::sqrt;
             using std::min;
@@ -396,12 +403,19 @@ This decomposition is very similar to the SVD (q.v.), and can be used to solve
 equations using backsub() or get_pinv(), with the same treatment of condition numbers.
 
 SymEigen<> (= SymEigen<-1>) can be used to create an eigen decomposition whose size is determined at run-time.
+The Layout parameter is the layout of the matrix used to store the eigenvectors. Use Bounded<N> with
+Size=Dynamic, or Stack with a large static Size, to avoid the heap: the results of backsub() etc then use the
+same storage.
 @ingroup gDecomps
 **/
-template <int Size=Dynamic, typename Precision = double>
+template <int Size=Dynamic, typename Precision = double, class Layout=RowMajor>
 class SymEigen {
+	typedef typename Internal::VectorResultBase<Size, Internal::MatrixCapacity<Layout>::rows, Internal::StorageOf<Layout>::value>::type VecBase;
+
 public:
-	inline SymEigen(){}
+	///Construct an empty decomposition, for static sizes only. This is a
+	///template so that it is only instantiated when used.
+	template<class Dummy=void> inline SymEigen(){}
 
         /// Initialise this eigen decomposition but do no immediately
         /// perform a decomposition.
@@ -421,15 +435,40 @@ public:
 	inline void compute(const Matrix<R,C,Precision,B>& m){
 		SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
 		SizeMismatch<R, Size>::test(m.num_rows(), my_evectors.num_rows());
+		TOON_INSTRUMENT_TIMED_OPERATION("SymEigen", 9.0*m.num_rows()*m.num_rows()*m.num_rows());
 		Internal::ComputeSymEigen<Size>::compute(m, my_evectors, my_evalues);
 	}
 
+	/// Construct the eigen decomposition of a symmetric matrix.
+	template<int S>
+	inline SymEigen(const SymmetricMatrix<S, Precision>& m) : my_evectors(m.size(), m.size()), my_evalues(m.size()) {
+		compute(m);
+	}
+
+	/// Perform the eigen decomposition of a symmetric matrix. Except for the
+	/// closed form 2x2 and 3x3 cases, the matrix is unpacked straight in to
+	/// the storage for the eigenvectors, so no other full matrix is formed.
+	template<int S>
+	inline void compute(const SymmetricMatrix<S, Precision>& m){
+		SizeMismatch<S, Size>::test(m.size(), my_evectors.num_rows());
+		if(Size == 2 || Size == 3)
+			compute(m.dense());
+		else
+		{
+			TOON_INSTRUMENT_TIMED_OPERATION("SymEigen", 9.0*m.size()*m.size()*m.size());
+			for(int r=0; r < m.size(); r++)
+				for(int c=r; c < m.size(); c++)
+					my_evectors(r,c) = my_evectors(c,r) = m(r,c);
+			Internal::ComputeSymEigen<Size>::compute(my_evectors, my_evectors, my_evalues);
+		}
+	}
+
 	/// Calculate result of multiplying the (pseudo-)inverse of M by a vector.
 	/// For a vector \f$b\f$, this calculates \f$M^{\dagger}b\f$ by back substitution
 	/// (i.e. without explictly calculating the (pseudo-)inverse).
 	/// See the SVD detailed description for a description of condition variables.
 	template <int S, typename P, typename B>
-	Vector<Size, Precision> backsub(const Vector<S,P,B>& rhs) const {
+	Vector<Size, Precision, VecBase> backsub(const Vector<S,P,B>& rhs) const {
 		return (my_evectors.T() * diagmult(get_inv_diag(Internal::symeigen_condition_no),(my_evectors * rhs)));
 	}
 
@@ -438,7 +477,7 @@ public:
 	/// (i.e. without explictly calculating the (pseudo-)inverse).
 	/// See the SVD detailed description for a description of condition variables.
 	template <int R, int C, typename P, typename B>
-	Matrix<Size,C, Precision> backsub(const Matrix<R,C,P,B>& rhs) const {
+	Matrix<Size,C, Precision, typename Internal::MatrixResultBase<Size, C, Internal::MatrixCapacity<Layout>::rows, Internal::MatrixCapacity<B>::cols, Internal::CombinedStorage<Layout, B>::value>::type> backsub(const Matrix<R,C,P,B>& rhs) const {
 		return (my_evectors.T() * diagmult(get_inv_diag(Internal::symeigen_condition_no),(my_evectors * rhs)));
 	}
 
@@ -447,7 +486,7 @@ public:
 	/// one of the backsub() functions, which will be faster.
 	/// See the SVD detailed description for a description of the pseudo-inverse
 	/// and condition variables.
-	Matrix<Size, Size, Precision> get_pinv(const double condition=Internal::symeigen_condition_no) const {
+	Matrix<Size, Size, Precision, Layout> get_pinv(const double condition=Internal::symeigen_condition_no) const {
 		return my_evectors.T() * diagmult(get_inv_diag(condition),my_evectors);
 	}
 
@@ -457,9 +496,9 @@ public:
 	/// These are also the diagonal values of the matrix \f$Lambda^{-1}\f$.
 	/// Any eigenvalues which are too small are set to zero (see the SVD
 	/// detailed description for a description of the and condition variables).
-	Vector<Size, Precision> get_inv_diag(const double condition) const {
+	Vector<Size, Precision, VecBase> get_inv_diag(const double condition) const {
 		Precision max_diag = -my_evalues[0] > my_evalues[my_evalues.size()-1] ? -my_evalues[0]:my_evalues[my_evalues.size()-1];
-		Vector<Size, Precision> invdiag(my_evalues.size());
+		Vector<Size, Precision, VecBase> invdiag(my_evalues.size());
 		for(int i=0; i<my_evalues.size(); i++){
 			if(fabs(my_evalues[i]) * condition > max_diag) {
 				invdiag[i] = 1/my_evalues[i];
@@ -475,20 +514,20 @@ public:
 	/// which can be extracted using usual Matrix::operator[]() subscript operator.
 	/// They are returned in order of the size of the corresponding eigenvalue, i.e.
 	/// the vector with the largest eigenvalue is first.
-	Matrix<Size,Size,Precision>& get_evectors() {return my_evectors;}
+	Matrix<Size,Size,Precision,Layout>& get_evectors() {return my_evectors;}
 
 	/**\overload
 	*/
-	const Matrix<Size,Size,Precision>& get_evectors() const {return my_evectors;}
+	const Matrix<Size,Size,Precision,Layout>& get_evectors() const {return my_evectors;}
 
 
 	/// Returns the eigenvalues of the matrix.
 	/// The eigenvalues are listed in order, from the smallest to the largest.
 	/// These are also the diagonal values of the matrix \f$\Lambda\f$.
-	Vector<Size, Precision>& get_evalues() {return my_evalues;}
+	Vector<Size, Precision, VecBase>& get_evalues() {return my_evalues;}
 	/**\overload
 	*/
-	const Vector<Size, Precision>& get_evalues() const {return my_evalues;}
+	const Vector<Size, Precision, VecBase>& get_evalues() const {return my_evalues;}
 
 	/// Is the matrix positive definite?
 	bool is_posdef() const {
@@ -519,8 +558,8 @@ public:
 
 	/// Calculate the square root of a matrix which is a matrix M
 	/// such that M.T*M=A.
-	Matrix<Size, Size, Precision> get_sqrtm () const {
-		Vector<Size, Precision> diag_sqrt(my_evalues.size());
+	Matrix<Size, Size, Precision, Layout> get_sqrtm () const {
+		Vector<Size, Precision, VecBase> diag_sqrt(my_evalues.size());
 		// In the future, maybe throw an exception if an
 		// eigenvalue is negative?
 		for (int i = 0; i < my_evalues.size(); ++i) {
@@ -535,8 +574,8 @@ public:
         /// Any square-rooted eigenvalues which are too small are set
         /// to zero (see the SVD detailed description for a
         /// description of the condition variables).
-	Matrix<Size, Size, Precision> get_isqrtm (const double condition=Internal::symeigen_condition_no) const {
-		Vector<Size, Precision> diag_isqrt(my_evalues.size());
+	Matrix<Size, Size, Precision, Layout> get_isqrtm (const double condition=Internal::symeigen_condition_no) const {
+		Vector<Size, Precision, VecBase> diag_isqrt(my_evalues.size());
 
 		// Because sqrt is a monotonic-preserving transformation,
 		Precision max_diag = -my_evalues[0] > my_evalues[my_evalues.size()-1] ? (-std::sqrt(my_evalues[0])):(std::sqrt(my_evalues[my_evalues.size()-1]));
@@ -555,9 +594,9 @@ public:
 
 private:
 	// eigen vectors laid out row-wise so evectors[i] is the ith evector
-	Matrix<Size,Size,Precision> my_evectors;
+	Matrix<Size,Size,Precision,Layout> my_evectors;
 
-	Vector<Size, Precision> my_evalues;
+	Vector<Size, Precision, VecBase> my_evalues;
 };
 
 }
@@ -36,6 +36,8 @@
 #include <utility>
 #include <vector>
 #include <complex>
+#include <iterator>
+#include <cstddef>
 #include <TooN/internal/config.hh>
 
 #if defined TOON_NDEBUG || defined NDEBUG
@@ -43,6 +45,7 @@
 	#define TOON_NDEBUG_SLICE
 	#define TOON_NDEBUG_SIZE
 	#define TOON_NDEBUG_FILL
+	#define TOON_NDEBUG_HEAP
 #endif
 
 #ifdef TOON_INITIALIZE_RANDOM
@@ -71,6 +74,8 @@ namespace TooN {
 		struct MatrixOverfill{};
 		struct StaticMatrixOverfill{};
 		struct Underfill{};
+		struct HeapAllocation{};
+		struct BoundedOverflow{};
 	}
 #endif
 	
@@ -136,8 +141,14 @@ namespace TooN {
 	{
 		///@internal
 		///@brief Maximum number of bytes to be allocated on the stack.
-		///new is used above this number.
-		static const unsigned int max_bytes_on_stack=1000;
+		///new is used above this number, unless the Stack storage policy
+		///is used. Set with <code>./configure --with-max_bytes_on_stack=N</code>
+		///or by defining \c TOON_MAX_BYTES_ON_STACK. See \ref sNoHeap.
+		#ifdef TOON_MAX_BYTES_ON_STACK
+			static const unsigned int max_bytes_on_stack=TOON_MAX_BYTES_ON_STACK;
+		#else
+			static const unsigned int max_bytes_on_stack=1000;
+		#endif
 		///@internal
 	 	///@brief A tag used to indicate that a slice is being constructed.
 		///@ingroup gInternal
@@ -305,6 +316,9 @@ namespace TooN {
 		template<int i> struct Sizer<i,i>{
 			static const int size = IsStatic<i>::is?i:Dynamic;
 		};
+
+		//A list of elements for filling a Vector or Matrix. See data.hh.
+		template<int N, class P> class Data;
 	}
 	
 	///All TooN classes default to using this precision for computations and storage.
@@ -328,12 +342,15 @@ namespace TooN {
 
 #include <TooN/internal/size_mismatch.hh>
 #include <TooN/internal/debug.hh>
+#include <TooN/internal/instrument.hh>
+#include <TooN/internal/no_alloc.hh>
 
 #include <TooN/internal/introspection.hh>
 
 
 #include <TooN/internal/dchecktest.hh>
 #include <TooN/internal/allocator.hh>
+#include <TooN/internal/iterator.hh>
 
 #include <TooN/internal/overfill_error.hh>
 #include <TooN/internal/slice_error.hh>
@@ -346,6 +363,8 @@ namespace TooN {
 #include <TooN/internal/mbase.hh>
 #include <TooN/internal/matrix.hh>
 #include <TooN/internal/reference.hh>
+#include <TooN/internal/storage.hh>
+#include <TooN/internal/bounded.hh>
 
 #include <TooN/internal/make_vector.hh>
 #include <TooN/internal/operators.hh>
@@ -353,6 +372,8 @@ namespace TooN {
 #include <TooN/internal/objects.h>
 
 #include <TooN/internal/diagmatrix.h>
+#include <TooN/internal/symmetric.hh>
+#include <TooN/internal/triangular.hh>
 
 #include <TooN/internal/data.hh>
 #include <TooN/internal/data_functions.hh>
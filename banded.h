@@ -0,0 +1,403 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+#ifndef TOON_INCLUDE_BANDED_H
+#define TOON_INCLUDE_BANDED_H
+
+#include <TooN/TooN.h>
+
+namespace TooN {
+
+/**
+@class BandedMatrix
+A square matrix whose nonzero elements all lie within Lower diagonals below
+and Upper diagonals above the leading diagonal. Only the band is stored, in
+the same layout as LAPACK band storage transposed: row r of band() holds
+elements (r, r-Lower) to (r, r+Upper). The storage and the cost of a
+matrix-vector product are therefore linear in the size.
+
+Symmetric banded systems, such as those from smoothing splines, can be
+solved in linear time with BandedCholesky:
+@code
+BandedMatrix<2> A(knots);
+A = Identity;
+for(int i=0; i < knots-2; i++)
+	A.add_sparse_JtWJ(second_difference, i, smoothing);  //1x3 Jacobian
+
+BandedCholesky<2> chol(A);
+Vector<> x = chol.backsub(b);
+@endcode
+@ingroup gLinAlg
+**/
+template<int Lower, int Upper=Lower, class Precision=DefaultPrecision>
+class BandedMatrix
+{
+	static_assert(Lower >= 0 && Upper >= 0, "BandedMatrix needs static, non-negative bandwidths");
+
+	public:
+		///The number of diagonals below the leading diagonal.
+		static const int lower = Lower;
+		///The number of diagonals above the leading diagonal.
+		static const int upper = Upper;
+		///The number of stored diagonals.
+		static const int width = Lower + Upper + 1;
+
+		///Construct an uninitialized matrix with the given size.
+		explicit BandedMatrix(int size)
+		:my_band(size, width)
+		{}
+
+		///Construct from the band of a square matrix. Elements outside the
+		///band are ignored.
+		template<int R, int C, class P, class B>
+		explicit BandedMatrix(const Matrix<R, C, P, B>& m)
+		:my_band(m.num_rows(), width)
+		{
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			for(int r=0; r < size(); r++)
+				for(int k=0; k < width; k++)
+				{
+					const int c = r + k - Lower;
+					my_band(r, k) = (c >= 0 && c < size()) ? Precision(m(r, c)) : Precision(0);
+				}
+		}
+
+		///@name Assignment
+		///@{
+
+		///Set all elements to zero.
+		BandedMatrix& operator=(const Operator<Internal::Zero>&)
+		{
+			my_band = Zeros;
+			return *this;
+		}
+
+		///Set the matrix to a multiple of the identity.
+		template<class P>
+		BandedMatrix& operator=(const Operator<Internal::Identity<P> >& op)
+		{
+			my_band = Zeros;
+			for(int i=0; i < size(); i++)
+				my_band(i, Lower) = op.val;
+			return *this;
+		}
+		///@}
+
+		///@name Access
+		///@{
+
+		///The number of rows (and columns).
+		int size() const
+		{
+			return my_band.num_rows();
+		}
+
+		///The number of rows.
+		int num_rows() const
+		{
+			return size();
+		}
+
+		///The number of columns.
+		int num_cols() const
+		{
+			return size();
+		}
+
+		///Is (r, c) inside the band?
+		static bool in_band(int r, int c)
+		{
+			return c - r >= -Lower && c - r <= Upper;
+		}
+
+		///Access an element. The element must be inside the band.
+		Precision& operator()(int r, int c)
+		{
+			Internal::check_index(size(), r);
+			Internal::check_index(size(), c);
+			Internal::check_index(width, c - r + Lower);
+			return my_band(r, c - r + Lower);
+		}
+
+		///Return element (r, c), which is zero outside the band.
+		Precision operator()(int r, int c) const
+		{
+			Internal::check_index(size(), r);
+			Internal::check_index(size(), c);
+			return in_band(r, c) ? my_band(r, c - r + Lower) : Precision(0);
+		}
+
+		///The stored band. Element (r, k) is element (r, r+k-Lower) of the
+		///matrix. Elements which would lie outside the matrix are unused.
+		Matrix<Dynamic, width, Precision>& band()
+		{
+			return my_band;
+		}
+
+		///The stored band. Element (r, k) is element (r, r+k-Lower) of the
+		///matrix. Elements which would lie outside the matrix are unused.
+		const Matrix<Dynamic, width, Precision>& band() const
+		{
+			return my_band;
+		}
+
+		///Expand the matrix to a full matrix.
+		Matrix<Dynamic, Dynamic, Precision> dense() const
+		{
+			Matrix<Dynamic, Dynamic, Precision> m(size(), size());
+			for(int r=0; r < size(); r++)
+				for(int c=0; c < size(); c++)
+					m(r, c) = (*this)(r, c);
+			return m;
+		}
+		///@}
+
+		///Add \f$J^\mathsf{T}WJ\f$ at the parameters starting at index, in the same
+		///way as WLS::add_sparse_mJ_rows. J must not span more parameters than
+		///the band is wide.
+		///@param J The Jacobian of the measurements with respect to the parameters
+		///@param index The first parameter J refers to
+		///@param invcov The inverse covariance of the measurements
+		template<int N, int S, class P1, class B1, class P2, class B2>
+		void add_sparse_JtWJ(const Matrix<N, S, P1, B1>& J, int index, const Matrix<N, N, P2, B2>& invcov)
+		{
+			const Matrix<S, N, Precision> temp = J.T() * invcov;
+			add_block(index, index, temp * J);
+		}
+
+		///Add \f$J^\mathsf{T}WJ\f$ for a Jacobian with two nonzero blocks, in the
+		///same way as WLS::add_sparse_mJ_rows. All the products of the two blocks
+		///must lie inside the band.
+		///@param J1 The first block of the Jacobian
+		///@param index1 The first parameter J1 refers to
+		///@param J2 The second block of the Jacobian
+		///@param index2 The first parameter J2 refers to
+		///@param invcov The inverse covariance of the measurements
+		template<int N, int S1, int S2, class P1, class B1, class P2, class B2, class P3, class B3>
+		void add_sparse_JtWJ(const Matrix<N, S1, P1, B1>& J1, int index1, const Matrix<N, S2, P2, B2>& J2, int index2, const Matrix<N, N, P3, B3>& invcov)
+		{
+			const Matrix<S1, N, Precision> temp1 = J1.T() * invcov;
+			const Matrix<S2, N, Precision> temp2 = J2.T() * invcov;
+			const Matrix<S1, S2, Precision> mixed = temp1 * J2;
+			add_block(index1, index1, temp1 * J1);
+			add_block(index2, index2, temp2 * J2);
+			add_block(index1, index2, mixed);
+			add_block(index2, index1, mixed.T());
+		}
+
+	private:
+		template<int R, int C, class P, class B>
+		void add_block(int r0, int c0, const Matrix<R, C, P, B>& m)
+		{
+			for(int r=0; r < m.num_rows(); r++)
+				for(int c=0; c < m.num_cols(); c++)
+					(*this)(r0 + r, c0 + c) += m(r, c);
+		}
+
+		Matrix<Dynamic, width, Precision> my_band;
+};
+
+///Write a matrix to a stream, in the same form as a Matrix.
+///@relates BandedMatrix
+template<int L, int U, class P>
+std::ostream& operator<<(std::ostream& os, const BandedMatrix<L, U, P>& m)
+{
+	return os << m.dense();
+}
+
+///Multiply a banded matrix by a vector.
+///@relates BandedMatrix
+template<int L, int U, class P1, int S, class P2, class B2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const BandedMatrix<L, U, P1>& m, const Vector<S, P2, B2>& v)
+{
+	SizeMismatch<Dynamic, S>::test(m.size(), v.size());
+	TOON_INSTRUMENT_OPERATION("banded * vector", 2.0*m.size()*(L+U+1));
+	const int n = m.size();
+	Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> r = Zeros(n);
+	for(int i=0; i < n; i++)
+		for(int j=std::max(0, i-L); j < std::min(n, i+U+1); j++)
+			r[i] += m.band()(i, j-i+L) * v[j];
+	return r;
+}
+
+///Multiply a vector by a banded matrix.
+///@relates BandedMatrix
+template<int S, class P1, class B1, int L, int U, class P2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const Vector<S, P1, B1>& v, const BandedMatrix<L, U, P2>& m)
+{
+	SizeMismatch<S, Dynamic>::test(v.size(), m.size());
+	TOON_INSTRUMENT_OPERATION("vector * banded", 2.0*m.size()*(L+U+1));
+	const int n = m.size();
+	Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> r = Zeros(n);
+	for(int i=0; i < n; i++)
+		for(int j=std::max(0, i-L); j < std::min(n, i+U+1); j++)
+			r[j] += v[i] * m.band()(i, j-i+L);
+	return r;
+}
+
+/**
+\f$LDL^\mathsf{T}\f$ decomposition of a symmetric BandedMatrix, where L is unit
+lower triangular with the same bandwidth as the matrix and D is diagonal. As
+with Cholesky, only the lower half of the matrix is considered, and the
+matrix need not be positive definite provided no pivot is zero.
+
+The run time of the decomposition is \f$O(nb^2)\f$ and that of backsub() is
+\f$O(nb)\f$ for an n by n matrix with Band diagonals either side of the leading
+diagonal, so large systems can be solved quickly:
+@code
+BandedCholesky<2> chol(A);
+Vector<> x = chol.backsub(b);
+@endcode
+@ingroup gDecomps
+**/
+template<int Band, class Precision=DefaultPrecision>
+class BandedCholesky
+{
+	public:
+		///Construct an empty decomposition.
+		BandedCholesky()
+		:my_factor(0, Band+1), my_rank(0)
+		{}
+
+		///Construct the decomposition of a matrix.
+		template<int U, class P2>
+		BandedCholesky(const BandedMatrix<Band, U, P2>& m)
+		:my_factor(m.size(), Band+1)
+		{
+			compute(m);
+		}
+
+		///Compute the decomposition of another matrix. Run time is \f$O(nb^2)\f$.
+		template<int U, class P2>
+		void compute(const BandedMatrix<Band, U, P2>& m)
+		{
+			const int n = m.size();
+			TOON_INSTRUMENT_TIMED_OPERATION("Banded Cholesky", (double)n*Band*Band);
+			if(my_factor.num_rows() != n)
+				my_factor = Matrix<Dynamic, Band+1, Precision>(n, Band+1);
+
+			//Row i of my_factor holds L(i, i-Band) ... L(i, i-1) followed by D(i).
+			my_rank = n;
+			for(int i=0; i < n; i++)
+			{
+				for(int j=std::max(0, i-Band); j <= i; j++)
+				{
+					Precision val = m.band()(i, j-i+Band);
+					for(int k=std::max(0, i-Band); k < j; k++)
+						val -= L(i, k) * L(j, k) * D(k);
+
+					if(j < i)
+						L(i, j) = val / D(j);
+					else
+					{
+						D(i) = val;
+						if(val == 0)
+						{
+							my_rank = i;
+							return;
+						}
+					}
+				}
+			}
+		}
+
+		///The number of rows (and columns) of the decomposed matrix.
+		int size() const
+		{
+			return my_factor.num_rows();
+		}
+
+		///Compute \f$M^{-1}v\f$. Run time is \f$O(nb)\f$.
+		template<int S, class P2, class B2>
+		Vector<Dynamic, Precision> backsub(const Vector<S, P2, B2>& v) const
+		{
+			SizeMismatch<Dynamic, S>::test(size(), v.size());
+			const int n = size();
+			Vector<Dynamic, Precision> x = v;
+
+			//backsub through L
+			for(int i=0; i < n; i++)
+				for(int k=std::max(0, i-Band); k < i; k++)
+					x[i] -= L(i, k) * x[k];
+
+			//backsub through D
+			for(int i=0; i < n; i++)
+				x[i] /= D(i);
+
+			//backsub through L^T
+			for(int i=n-1; i >= 0; i--)
+				for(int j=i+1; j < std::min(n, i+Band+1); j++)
+					x[i] -= L(j, i) * x[j];
+
+			return x;
+		}
+
+		///Compute \f$M^{-1}B\f$, one column at a time.
+		template<int R, int C, class P2, class B2>
+		Matrix<Dynamic, C, Precision> backsub(const Matrix<R, C, P2, B2>& b) const
+		{
+			SizeMismatch<Dynamic, R>::test(size(), b.num_rows());
+			Matrix<Dynamic, C, Precision> x(b.num_rows(), b.num_cols());
+			for(int c=0; c < b.num_cols(); c++)
+				x.T()[c] = backsub(b.T()[c]);
+			return x;
+		}
+
+		///Compute the determinant.
+		Precision determinant() const
+		{
+			Precision d = 1;
+			for(int i=0; i < size(); i++)
+				d *= D(i);
+			return d;
+		}
+
+		///The diagonal matrix D, as a vector.
+		Vector<Dynamic, Precision> get_D() const
+		{
+			return my_factor.T()[Band];
+		}
+
+		///The number of nonzero pivots found before the decomposition stopped.
+		int rank() const
+		{
+			return my_rank;
+		}
+
+	private:
+		Precision& L(int i, int j) { return my_factor(i, j-i+Band); }
+		const Precision& L(int i, int j) const { return my_factor(i, j-i+Band); }
+		Precision& D(int i) { return my_factor(i, Band); }
+		const Precision& D(int i) const { return my_factor(i, Band); }
+
+		Matrix<Dynamic, Band+1, Precision> my_factor;
+		int my_rank;
+};
+
+}
+
+#endif
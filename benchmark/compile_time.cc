@@ -0,0 +1,57 @@
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+// Compile time benchmark.
+//
+// A typical translation unit using TooN: it includes the headers and fills
+// vectors and matrices of several sizes with makeVector and Data. It is not
+// meant to be run. "make compiletime" times compiling it with and without a
+// precompiled header.
+
+#include <TooN/TooN.h>
+#include <TooN/se3.h>
+#include <TooN/Cholesky.h>
+
+using namespace TooN;
+
+double compile_time()
+{
+	Vector<3> a = makeVector(1, 2, 3);
+	Vector<6> b = makeVector(1, 2, 3, 4, 5, 6);
+	Vector<4, float> c = makeVector(1.f, 2.f, 3.f, 4.f);
+	Matrix<3> m = Data(1, 2, 3, 4, 5, 6, 7, 8, 10);
+	Matrix<4> n = Data(4, 1, 0, 0,
+	                   1, 4, 1, 0,
+	                   0, 1, 4, 1,
+	                   0, 0, 1, 4);
+	Matrix<6> p = Identity;
+	p.slice<0, 0, 3, 3>() = m;
+
+	SE3<> pose = SE3<>::exp(b);
+	Cholesky<4> chol(n);
+
+	return a * (m * a) + norm(pose * a) + chol.determinant() + c[0] + (p * b)[5];
+}
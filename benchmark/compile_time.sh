@@ -0,0 +1,40 @@
+#!/bin/sh
+# Time compiling benchmark/compile_time.cc, first parsing the TooN headers
+# and then with them precompiled. The compiler and flags are the arguments,
+# for example:
+#	sh benchmark/compile_time.sh g++ -O2 -I .. -I .
+# Prints the fastest of REPEAT compilations in milliseconds.
+
+REPEAT=${REPEAT:-5}
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+now(){
+	date +%s%N
+}
+
+fastest(){
+	best=
+	i=0
+	while [ $i -lt $REPEAT ]
+	do
+		start=$(now)
+		"$@" || exit 1
+		t=$(( ($(now) - start) / 1000000 ))
+		if [ -z "$best" ] || [ $t -lt $best ]
+		then
+			best=$t
+		fi
+		i=$((i+1))
+	done
+	echo $best
+}
+
+echo '#include <TooN/TooN.h>' > "$tmp/toon_pch.h"
+"$@" -x c++-header "$tmp/toon_pch.h" -o "$tmp/toon_pch.h.gch" || exit 1
+
+plain=$(fastest "$@" -c benchmark/compile_time.cc -o "$tmp/plain.o")
+pch=$(fastest "$@" -include "$tmp/toon_pch.h" -Winvalid-pch -c benchmark/compile_time.cc -o "$tmp/pch.o")
+
+echo "compile_time/headers      $plain ms"
+echo "compile_time/precompiled  $pch ms"
@@ -78,7 +78,7 @@ for S=5:5
 		end
 	end
 	
-	out{end+1} = '	for(unsigned int i=0; i < x.num_cols(); i++)';
+	out{end+1} = '	for(int i=0; i < x.num_cols(); i++)';
 	out{end+1} = '	{';
 	for r=1:S
 		row = ['		x[' num2str(r-1) '][i] = '];
@@ -0,0 +1,329 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_BENCHMARK_HARNESS_H
+#define TOON_BENCHMARK_HARNESS_H
+
+// A minimal timing harness for the TooN benchmarks.
+//
+// Each benchmark is a functor which performs one operation. The harness
+// calibrates the number of calls per sample so that a sample is long enough
+// to be timed accurately, runs some warmup samples, then records a number of
+// samples and reports the median, 99th percentile and minimum time per call.
+//
+// Times are reported both in nanoseconds (from std::chrono::steady_clock) and
+// in reference cycles. On x86 the reference cycle count comes from the time
+// stamp counter, which ticks at a constant rate regardless of the current
+// core frequency, so results are comparable across power states. On other
+// platforms the cycle count falls back to nanoseconds.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace TooN {
+namespace Bench {
+
+///Read the constant-rate reference cycle counter.
+inline std::uint64_t reference_cycles()
+{
+#if defined(__i386__) || defined(__x86_64__)
+	return __rdtsc();
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+///Prevent the compiler from discarding the computation of v.
+template<class T> inline void do_not_optimize(const T& v)
+{
+#if defined __GNUC__
+	asm volatile("" : : "g"(&v) : "memory");
+#else
+	static volatile const void* sink;
+	sink = &v;
+#endif
+}
+
+///Force all pending writes to memory to be considered observed.
+inline void clobber_memory()
+{
+#if defined __GNUC__
+	asm volatile("" : : : "memory");
+#endif
+}
+
+///Order statistics for a set of per-call timings.
+struct Statistics
+{
+	double median;
+	double p99;
+	double min;
+
+	static Statistics from(std::vector<double> v)
+	{
+		Statistics s = {0, 0, 0};
+		if(v.empty())
+			return s;
+
+		std::sort(v.begin(), v.end());
+		s.min = v.front();
+		s.median = v[v.size()/2];
+		s.p99 = v[std::min(v.size()-1, static_cast<size_t>(v.size() * 0.99))];
+		return s;
+	}
+};
+
+///The result of a single benchmark.
+struct Result
+{
+	std::string name;
+	long calls_per_sample;
+	int samples;
+	Statistics ns;      ///< Nanoseconds per call
+	Statistics cycles;  ///< Reference cycles per call
+};
+
+///Options controlling how benchmarks are run.
+struct Options
+{
+	int warmup;               ///< Number of samples discarded before measurement
+	int samples;              ///< Number of samples recorded
+	double min_sample_time;   ///< Minimum duration of a sample in seconds
+	std::string filter;       ///< Only run benchmarks whose name contains this
+	std::string json;         ///< Write JSON results to this file ("-" for stdout)
+	bool quiet;               ///< Do not print the results table
+
+	Options()
+	:warmup(3), samples(51), min_sample_time(2e-4), quiet(false)
+	{}
+};
+
+///Parse the standard benchmark command line:
+///@code
+/// --samples N  --warmup N  --min-time SECONDS  --filter SUBSTRING  --json FILE  --quiet
+///@endcode
+inline Options parse_options(int argc, char** argv)
+{
+	Options o;
+	for(int i=1; i < argc; i++)
+	{
+		std::string a = argv[i];
+		bool has_arg = i+1 < argc;
+
+		if(a == "--samples" && has_arg)
+			o.samples = std::max(1, std::atoi(argv[++i]));
+		else if(a == "--warmup" && has_arg)
+			o.warmup = std::max(0, std::atoi(argv[++i]));
+		else if(a == "--min-time" && has_arg)
+			o.min_sample_time = std::atof(argv[++i]);
+		else if(a == "--filter" && has_arg)
+			o.filter = argv[++i];
+		else if(a == "--json" && has_arg)
+			o.json = argv[++i];
+		else if(a == "--quiet")
+			o.quiet = true;
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--samples N] [--warmup N] [--min-time SECONDS] [--filter SUBSTRING] [--json FILE] [--quiet]\n";
+			std::exit(1);
+		}
+	}
+	return o;
+}
+
+///Runs benchmarks and collects their results.
+class Runner
+{
+	public:
+		Runner(const Options& o)
+		:opts(o)
+		{}
+
+		///Time func, which performs one operation per call.
+		template<class Func> void run(const std::string& name, Func func)
+		{
+			if(!opts.filter.empty() && name.find(opts.filter) == std::string::npos)
+				return;
+
+			//Calibrate: double the number of calls until a sample is long enough.
+			long calls=1;
+			for(;;)
+			{
+				double t = sample(func, calls).first;
+				if(t * 1e-9 * calls >= opts.min_sample_time || calls > (1L<<30))
+					break;
+				calls *= 2;
+			}
+
+			for(int i=0; i < opts.warmup; i++)
+				sample(func, calls);
+
+			std::vector<double> ns, cyc;
+			for(int i=0; i < opts.samples; i++)
+			{
+				std::pair<double, double> s = sample(func, calls);
+				ns.push_back(s.first);
+				cyc.push_back(s.second);
+			}
+
+			Result r;
+			r.name = name;
+			r.calls_per_sample = calls;
+			r.samples = opts.samples;
+			r.ns = Statistics::from(ns);
+			r.cycles = Statistics::from(cyc);
+			results.push_back(r);
+
+			if(!opts.quiet)
+				print_row(std::cout, r);
+		}
+
+		const std::vector<Result>& get_results() const
+		{
+			return results;
+		}
+
+		///Print the results table header.
+		void print_header(std::ostream& o) const
+		{
+			if(opts.quiet)
+				return;
+			o << std::left << std::setw(40) << "benchmark" << std::right
+			  << std::setw(14) << "median ns" << std::setw(14) << "p99 ns"
+			  << std::setw(14) << "median cyc" << std::setw(14) << "p99 cyc" << std::endl;
+		}
+
+		///Write all results as a JSON document.
+		void print_json(std::ostream& o) const
+		{
+			o << "{\n";
+			o << "  \"library\": \"TooN\",\n";
+			#ifdef __VERSION__
+				o << "  \"compiler\": \"" << escape(__VERSION__) << "\",\n";
+			#endif
+			o << "  \"samples\": " << opts.samples << ",\n";
+			o << "  \"warmup\": " << opts.warmup << ",\n";
+			o << "  \"benchmarks\": [";
+			for(size_t i=0; i < results.size(); i++)
+			{
+				const Result& r = results[i];
+				o << (i?",":"") << "\n    {\"name\": \"" << escape(r.name) << "\""
+				  << ", \"calls_per_sample\": " << r.calls_per_sample
+				  << ", \"samples\": " << r.samples
+				  << ", \"ns\": " << stats(r.ns)
+				  << ", \"cycles\": " << stats(r.cycles) << "}";
+			}
+			o << "\n  ]\n}\n";
+		}
+
+		///Write the JSON document to the file given in the options, if any.
+		///@return false if the file could not be written.
+		bool write_json() const
+		{
+			if(opts.json.empty())
+				return true;
+			else if(opts.json == "-")
+			{
+				print_json(std::cout);
+				return true;
+			}
+
+			std::ofstream o(opts.json.c_str());
+			print_json(o);
+			if(!o.good())
+			{
+				std::cerr << "Error writing " << opts.json << std::endl;
+				return false;
+			}
+			return true;
+		}
+
+	private:
+		Options opts;
+		std::vector<Result> results;
+
+		template<class Func> static std::pair<double, double> sample(Func& func, long calls)
+		{
+			std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+			std::uint64_t c0 = reference_cycles();
+			for(long i=0; i < calls; i++)
+			{
+				func();
+				clobber_memory();
+			}
+			std::uint64_t c1 = reference_cycles();
+			std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+			double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+			return std::make_pair(ns / calls, static_cast<double>(c1 - c0) / calls);
+		}
+
+		static void print_row(std::ostream& o, const Result& r)
+		{
+			o << std::left << std::setw(40) << r.name << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(14) << r.ns.median << std::setw(14) << r.ns.p99
+			  << std::setw(14) << r.cycles.median << std::setw(14) << r.cycles.p99 << std::endl;
+			o.unsetf(std::ios::floatfield);
+		}
+
+		static std::string stats(const Statistics& s)
+		{
+			std::ostringstream o;
+			o << std::setprecision(6) << "{\"median\": " << s.median << ", \"p99\": " << s.p99 << ", \"min\": " << s.min << "}";
+			return o.str();
+		}
+
+		static std::string escape(const std::string& s)
+		{
+			std::string r;
+			for(size_t i=0; i < s.size(); i++)
+			{
+				if(s[i] == '"' || s[i] == '\\')
+					r += '\\';
+				r += s[i];
+			}
+			return r;
+		}
+};
+
+}
+}
+
+#endif
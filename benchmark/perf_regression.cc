@@ -0,0 +1,109 @@
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+// Performance regression driver.
+//
+// This builds one of the programs in regressions/ with its main() renamed,
+// then times complete runs of the program in-process using the benchmark
+// harness. Output from the program is discarded. The result is printed as
+//
+//    name min_ns median_ns p99_ns
+//
+// and compared against the stored baseline by perfdiff.awk. See "make perftest".
+// The fastest run is used for the comparison, since interference from the
+// rest of the system can only ever make a run slower.
+//
+// Compile with -DTOON_REGRESSION_NAME='"name"' -DTOON_REGRESSION_SOURCE='"regressions/name.cc"'
+
+#ifndef TOON_REGRESSION_SOURCE
+	#error TOON_REGRESSION_SOURCE must name the regression program to time
+#endif
+
+#define main toon_regression_main
+#include TOON_REGRESSION_SOURCE
+#undef main
+
+#include "harness.h"
+
+#include <iostream>
+#include <streambuf>
+
+namespace {
+
+	//Regression programs are declared with either of the usual signatures.
+	inline int call_regression(int (*f)())
+	{
+		return f();
+	}
+
+	inline int call_regression(int (*f)(int, char**))
+	{
+		static char name[] = TOON_REGRESSION_NAME;
+		static char* argv[] = {name, 0};
+		return f(1, argv);
+	}
+
+	struct NullBuffer: public std::streambuf
+	{
+		int overflow(int c)
+		{
+			return c;
+		}
+	};
+}
+
+int main(int argc, char** argv)
+{
+	TooN::Bench::Options opts = TooN::Bench::parse_options(argc, argv);
+	opts.quiet = true;
+	TooN::Bench::Runner runner(opts);
+
+	//The program may change the stream formatting as well as writing to it.
+	std::ios format(0);
+	format.copyfmt(std::cout);
+
+	NullBuffer null;
+	std::streambuf* out = std::cout.rdbuf(&null);
+	std::streambuf* err = std::cerr.rdbuf(&null);
+
+	int status=0;
+	runner.run(TOON_REGRESSION_NAME, [&]{ status |= call_regression(toon_regression_main); });
+
+	std::cout.rdbuf(out);
+	std::cerr.rdbuf(err);
+	std::cout.copyfmt(format);
+
+	if(status != 0)
+	{
+		std::cerr << TOON_REGRESSION_NAME << " exited with status " << status << std::endl;
+		return 1;
+	}
+
+	const TooN::Bench::Result& r = runner.get_results().front();
+	std::cout << r.name << " " << r.ns.min << " " << r.ns.median << " " << r.ns.p99 << std::endl;
+
+	return runner.write_json()?0:1;
+}
@@ -3,30 +3,18 @@
 #include <TooN/helpers.h>
 #include <TooN/gaussian_elimination.h>
 #include <TooN/gauss_jordan.h>
-#include <tr1/random>
-#include <sys/time.h>  //gettimeofday
-#include <vector>
-#include <utility>
+#include "harness.h"
+#include <random>
 #include <string>
-#include <map>
-#include <algorithm>
-#include <iomanip>
+#include <sstream>
 
 
 using namespace TooN;
+using namespace TooN::Bench;
 using namespace std;
-using namespace tr1;
 
-double get_time_of_day()
-{
-	struct timeval tv;
-	gettimeofday(&tv,NULL);
-	return tv.tv_sec+tv.tv_usec * 1e-6;
-}
-
-std::tr1::mt19937 eng;
-std::tr1::uniform_real<double> rnd;
-double global_sum;
+mt19937 eng;
+uniform_real_distribution<double> rnd;
 
 #include "solvers.cc"
 
@@ -123,37 +111,25 @@ struct UseGaussJordanInverse
 };
 
 
-template<int Size, int Cols, class Solver> void benchmark_ax_eq_b(map<string, vector<double> >& results)
+template<int Size, int Cols, class Solver> void benchmark_ax_eq_b(Runner& runner)
 {
-	double time=0, t_tmp, start = get_time_of_day(), t_tmp2;
-	double sum=0;
-	int n=0;
+	Matrix<Size> a;
+	for(int r=0; r < Size; r++)
+		for(int c=0; c < Size; c++)
+			a[r][c] = rnd(eng);
 
-	while(get_time_of_day() - start < .1)
-	{
-		Matrix<Size> a;
-		for(int r=0; r < Size; r++)
-			for(int c=0; c < Size; c++)
-				a[r][c] = rnd(eng);
-			
+	Matrix<Size, Cols> b, x;
+	for(int r=0; r < Size; r++)
+		for(int c=0; c < Cols; c++)
+			b[r][c] = rnd(eng);
 
-		Matrix<Size, Cols> b, x;
+	ostringstream name;
+	name << "solve_ax_equals_b/" << Solver::name() << "/" << Size << "x" << Cols;
 
-		for(int r=0; r < Size; r++)
-			for(int c=0; c < Cols; c++)
-				b[r][c] = rnd(eng);
-		
-		a[0][0] += (t_tmp=get_time_of_day()) * 1e-20;
+	runner.run(name.str(), [&]{
 		Solver::template solve<Size, Cols>(a, b, x);
-		global_sum += (t_tmp2=get_time_of_day())*x[Size-1][Cols-1];
-			
-		time += t_tmp2 - t_tmp;
-		n++;
-	}
-
-	results[Solver::name()].push_back(n/time);
-
-	global_sum += sum;	
+		do_not_optimize(x);
+	});
 }
 
 
@@ -161,7 +137,7 @@ template<int Size, int Cols, class Solver> void benchmark_ax_eq_b(map<string, ve
 
 template<int Size, int Cols, typename Solver, bool Use> struct Optional
 {
-	static void solve(map<string, vector<double> >& r)
+	static void solve(Runner& r)
 	{
 		benchmark_ax_eq_b<Size, Cols, Solver>(r);
 	}
@@ -170,53 +146,34 @@ template<int Size, int Cols, typename Solver, bool Use> struct Optional
 
 template<int Size, int Cols, typename Solver > struct Optional<Size, Cols, Solver, 0>
 {
-	static void solve(map<string, vector<double> >&)
+	static void solve(Runner&)
 	{
 	}
 };
 
 template<int Size, int C=1, bool End=0> struct ColIter
 {
-	static void iter()
+	static void iter(Runner& runner)
 	{
 		static const int Lin = Size*2;
 		static const int Grow = 1;
 		static const int Cols = C + (C<=Lin?0:(C-Lin)*(C-Lin)*(C-Lin)/Grow);
-		map<string, vector<double> > results;
-		cout << Size << "\t" << Cols << "\t";
-		
-		//Run each menchmark 10 times and select the median result
-		for(int i=0; i < 10; i++)
-		{
-			benchmark_ax_eq_b<Size, Cols, UseGaussJordanInverse>(results);
-			benchmark_ax_eq_b<Size, Cols, UseGaussianElimination>(results);
-			benchmark_ax_eq_b<Size, Cols, UseGaussianEliminationInverse>(results);
-			benchmark_ax_eq_b<Size, Cols, UseLUInv>(results);
-			benchmark_ax_eq_b<Size, Cols, UseLU>(results);
-			Optional<Size, Cols, UseCompiledCramer, (Size<=highest_solver)>::solve(results);
-		}
 		
-		vector<pair<double, string> > res;
-		for(map<string, vector<double> >::iterator i=results.begin(); i != results.end(); i++)
-		{
-			sort(i->second.begin(), i->second.end());
-			res.push_back(make_pair(i->second[i->second.size()/2], i->first));
-		}
-
+		benchmark_ax_eq_b<Size, Cols, UseGaussJordanInverse>(runner);
+		benchmark_ax_eq_b<Size, Cols, UseGaussianElimination>(runner);
+		benchmark_ax_eq_b<Size, Cols, UseGaussianEliminationInverse>(runner);
+		benchmark_ax_eq_b<Size, Cols, UseLUInv>(runner);
+		benchmark_ax_eq_b<Size, Cols, UseLU>(runner);
+		Optional<Size, Cols, UseCompiledCramer, (Size<=highest_solver)>::solve(runner);
 
-
-		sort(res.begin(), res.end());
-		for(unsigned int i=0; i < res.size(); i++)
-			cout << res[i].second << " " << setprecision(5) << setw(10) << res[i].first << "            ";
-		cout << endl;
-		ColIter<Size, C+1, (Cols> Size*1000)>::iter();
+		ColIter<Size, C+1, (Cols> Size*1000)>::iter(runner);
 	}
 };
 
 template<int Size, int C> struct ColIter<Size, C, 1> 
 {
 
-	static void iter()
+	static void iter(Runner&)
 	{
 	}
 };
@@ -225,9 +182,13 @@ template<int Size, int C> struct ColIter<Size, C, 1>
 	#define SIZE 2
 #endif
 
-int main()
+int main(int argc, char** argv)
 {
-	ColIter<SIZE>::iter();
-	
-	return global_sum != 123456789.0;
+	Options opts = parse_options(argc, argv);
+	Runner runner(opts);
+	runner.print_header(cout);
+
+	ColIter<SIZE>::iter(runner);
+
+	return runner.write_json()?0:1;
 }
@@ -10,7 +10,7 @@ template<int Cols> void solve_direct(const Matrix<2>& A, const Matrix<2, Cols>&
 	double i10 = t0*idet;
                                                   t0 = A[0][0];
 	double i11 = t0*idet;
-	for(unsigned int i=0; i < x.num_cols(); i++)
+	for(int i=0; i < x.num_cols(); i++)
 	{
 		x[0][i] = i00*b[0][i] + i01*b[1][i];
 		x[1][i] = i10*b[0][i] + i11*b[1][i];
@@ -38,7 +38,7 @@ template<int Cols> void solve_direct(const Matrix<3>& A, const Matrix<3, Cols>&
 	double i21 = t0*idet;
                                                   t0 = A[0][0]*A[1][1]-A[0][1]*A[1][0];
 	double i22 = t0*idet;
-	for(unsigned int i=0; i < x.num_cols(); i++)
+	for(int i=0; i < x.num_cols(); i++)
 	{
 		x[0][i] = i00*b[0][i] + i01*b[1][i] + i02*b[2][i];
 		x[1][i] = i10*b[0][i] + i11*b[1][i] + i12*b[2][i];
@@ -81,7 +81,7 @@ template<int Cols> void solve_direct(const Matrix<4>& A, const Matrix<4, Cols>&
 	double i32 = t0*idet;
                                                   t0 = A[0][0]*A[1][1]*A[2][2]-A[0][0]*A[1][2]*A[2][1]-A[1][0]*A[0][1]*A[2][2]+A[1][0]*A[0][2]*A[2][1]+A[2][0]*A[0][1]*A[1][2]-A[2][0]*A[0][2]*A[1][1];
 	double i33 = t0*idet;
-	for(unsigned int i=0; i < x.num_cols(); i++)
+	for(int i=0; i < x.num_cols(); i++)
 	{
 		x[0][i] = i00*b[0][i] + i01*b[1][i] + i02*b[2][i] + i03*b[3][i];
 		x[1][i] = i10*b[0][i] + i11*b[1][i] + i12*b[2][i] + i13*b[3][i];
@@ -150,7 +150,7 @@ template<int Cols> void solve_direct(const Matrix<5>& A, const Matrix<5, Cols>&
 	double i43 = t0*idet;
                                                   t0 = A[0][0]*A[1][1]*A[2][2]*A[3][3]-A[0][0]*A[1][1]*A[2][3]*A[3][2]-A[0][0]*A[2][1]*A[1][2]*A[3][3]+A[0][0]*A[2][1]*A[1][3]*A[3][2]+A[0][0]*A[3][1]*A[1][2]*A[2][3]-A[0][0]*A[3][1]*A[1][3]*A[2][2]-A[1][0]*A[0][1]*A[2][2]*A[3][3]+A[1][0]*A[0][1]*A[2][3]*A[3][2]+A[1][0]*A[2][1]*A[0][2]*A[3][3]-A[1][0]*A[2][1]*A[0][3]*A[3][2]-A[1][0]*A[3][1]*A[0][2]*A[2][3]+A[1][0]*A[3][1]*A[0][3]*A[2][2]+A[2][0]*A[0][1]*A[1][2]*A[3][3]-A[2][0]*A[0][1]*A[1][3]*A[3][2]-A[2][0]*A[1][1]*A[0][2]*A[3][3]+A[2][0]*A[1][1]*A[0][3]*A[3][2]+A[2][0]*A[3][1]*A[0][2]*A[1][3]-A[2][0]*A[3][1]*A[0][3]*A[1][2]-A[3][0]*A[0][1]*A[1][2]*A[2][3]+A[3][0]*A[0][1]*A[1][3]*A[2][2]+A[3][0]*A[1][1]*A[0][2]*A[2][3]-A[3][0]*A[1][1]*A[0][3]*A[2][2]-A[3][0]*A[2][1]*A[0][2]*A[1][3]+A[3][0]*A[2][1]*A[0][3]*A[1][2];
 	double i44 = t0*idet;
-	for(unsigned int i=0; i < x.num_cols(); i++)
+	for(int i=0; i < x.num_cols(); i++)
 	{
 		x[0][i] = i00*b[0][i] + i01*b[1][i] + i02*b[2][i] + i03*b[3][i] + i04*b[4][i];
 		x[1][i] = i10*b[0][i] + i11*b[1][i] + i12*b[2][i] + i13*b[3][i] + i14*b[4][i];
@@ -0,0 +1,523 @@
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+// TooN benchmark suite.
+//
+// Times the hot paths of the library: matrix products at fixed and dynamic
+// sizes, every decomposition, WLS accumulation, SE3, splines, averaging and
+// the optimizers.
+// Build and run with "make bench". Results are printed as a table, and
+// can be written as JSON with --json FILE so that they can be compared
+// between releases.
+
+#include <TooN/TooN.h>
+#include <TooN/Cholesky.h>
+#include <TooN/GR_SVD.h>
+#include <TooN/QR.h>
+#include <TooN/gaussian_elimination.h>
+#include <TooN/gauss_jordan.h>
+#include <TooN/determinant.h>
+#include <TooN/wls.h>
+#include <TooN/sparse.h>
+#include <TooN/se3.h>
+#include <TooN/spline.h>
+#include <TooN/rotation_averaging.h>
+#include <TooN/sl.h>
+#include <TooN/helpers.h>
+#include <TooN/optimization/conjugate_gradient.h>
+#include <TooN/optimization/downhill_simplex.h>
+#include <TooN/optimization/brent.h>
+#include <TooN/optimization/golden_section.h>
+
+#ifdef TOON_USE_LAPACK
+	#include <TooN/LU.h>
+	#include <TooN/SVD.h>
+	#include <TooN/SymEigen.h>
+	#include <TooN/QR_Lapack.h>
+	#include <TooN/Lapack_Cholesky.h>
+#endif
+
+#include "harness.h"
+
+#include <random>
+#include <sstream>
+
+using namespace TooN;
+using namespace TooN::Bench;
+using namespace std;
+
+static mt19937 eng(12345);
+
+static double rnd()
+{
+	static uniform_real_distribution<double> u(-1, 1);
+	return u(eng);
+}
+
+template<int R, int C> Matrix<R, C> random_matrix(int r=R, int c=C)
+{
+	Matrix<R, C> m(r, c);
+	for(int i=0; i < m.num_rows(); i++)
+		for(int j=0; j < m.num_cols(); j++)
+			m[i][j] = rnd();
+	return m;
+}
+
+template<int S> Vector<S> random_vector(int s=S)
+{
+	Vector<S> v(s);
+	for(int i=0; i < v.size(); i++)
+		v[i] = rnd();
+	return v;
+}
+
+//Symmetric, positive definite, well conditioned.
+template<int S> Matrix<S> random_spd(int s=S)
+{
+	Matrix<S, S> a = random_matrix<S,S>(s, s);
+	Matrix<S> m = a * a.T();
+	for(int i=0; i < s; i++)
+		m[i][i] += s;
+	return m;
+}
+
+static string sz(const string& base, int r, int c, bool fixed)
+{
+	ostringstream o;
+	o << base << "/" << (fixed?"fixed":"dynamic") << "/" << r << "x" << c;
+	return o.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Products
+//
+
+template<int N> void bench_products_fixed(Runner& r)
+{
+	Matrix<N> a = random_matrix<N,N>(), b = random_matrix<N,N>(), c;
+	Vector<N> x = random_vector<N>(), y;
+
+	r.run(sz("gemm", N, N, true), [&]{ c = a * b; do_not_optimize(c); });
+	r.run(sz("gemv", N, 1, true), [&]{ y = a * x; do_not_optimize(y); });
+	r.run(sz("gemv_transpose", N, 1, true), [&]{ y = x * a; do_not_optimize(y); });
+}
+
+static void bench_products_dynamic(Runner& r, int n)
+{
+	Matrix<> a = random_matrix<Dynamic,Dynamic>(n, n), b = random_matrix<Dynamic,Dynamic>(n, n), c(n, n);
+	Vector<> x = random_vector<Dynamic>(n), y(n);
+
+	r.run(sz("gemm", n, n, false), [&]{ c = a * b; do_not_optimize(c); });
+	r.run(sz("gemv", n, 1, false), [&]{ y = a * x; do_not_optimize(y); });
+	r.run(sz("gemv_transpose", n, 1, false), [&]{ y = x * a; do_not_optimize(y); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Diagonal matrices. The dense versions convert the diagonal matrix to a
+// Matrix first, for comparison.
+//
+
+static void bench_diagonal(Runner& r, int n)
+{
+	const Matrix<> spd = random_spd<Dynamic>(n);
+	const Vector<> d = random_vector<Dynamic>(n);
+	Matrix<> c(n, n);
+	Vector<> x(n);
+	const Vector<> b = random_vector<Dynamic>(n);
+
+	r.run(sz("diagonal_add_dense", n, n, false), [&]{ c = spd + Matrix<>(d.as_diagonal()); do_not_optimize(c); });
+	r.run(sz("diagonal_add", n, n, false), [&]{ c = spd + d.as_diagonal(); do_not_optimize(c); });
+	r.run(sz("diagonal_multiply_dense", n, n, false), [&]{ c = spd * Matrix<>(d.as_diagonal()); do_not_optimize(c); });
+	r.run(sz("diagonal_multiply", n, n, false), [&]{ c = spd * d.as_diagonal(); do_not_optimize(c); });
+	r.run(sz("lm_damping", n, n, false), [&]{
+		Cholesky<> chol(spd + 0.1 * spd.diagonal_slice().as_diagonal());
+		x = chol.backsub(b);
+		do_not_optimize(x);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Decompositions and linear solvers
+//
+
+template<int N> void bench_decompositions_fixed(Runner& r)
+{
+	const Matrix<N> spd = random_spd<N>();
+	const Matrix<N> a = random_matrix<N,N>();
+	const Vector<N> b = random_vector<N>();
+	Vector<N> x;
+	Matrix<N> inv;
+
+	r.run(sz("cholesky", N, N, true), [&]{ Cholesky<N> c(spd); x = c.backsub(b); do_not_optimize(x); });
+	r.run(sz("gr_svd", N, N, true), [&]{ GR_SVD<N> s(a); x = s.backsub(b); do_not_optimize(x); });
+	r.run(sz("qr", N, N, true), [&]{ QR<N> q(a); do_not_optimize(q.get_R()); });
+	r.run(sz("gaussian_elimination", N, N, true), [&]{ x = gaussian_elimination(a, b); do_not_optimize(x); });
+	r.run(sz("gauss_jordan", N, N, true), [&]{
+		Matrix<N, 2*N> m;
+		m.template slice<0,0,N,N>() = a;
+		m.template slice<0,N,N,N>() = Identity;
+		gauss_jordan(m);
+		do_not_optimize(m);
+	});
+	r.run(sz("determinant", N, N, true), [&]{ double d = determinant(a); do_not_optimize(d); });
+
+	#ifdef TOON_USE_LAPACK
+		r.run(sz("lapack_cholesky", N, N, true), [&]{ Lapack_Cholesky<N> c(spd); x = c.backsub(b); do_not_optimize(x); });
+		r.run(sz("lu", N, N, true), [&]{ LU<N> l(a); x = l.backsub(b); do_not_optimize(x); });
+		r.run(sz("lu_inverse", N, N, true), [&]{ LU<N> l(a); inv = l.get_inverse(); do_not_optimize(inv); });
+		r.run(sz("svd", N, N, true), [&]{ SVD<N> s(a); x = s.backsub(b); do_not_optimize(x); });
+		r.run(sz("sym_eigen", N, N, true), [&]{ SymEigen<N> e(spd); do_not_optimize(e.get_evalues()); });
+		r.run(sz("qr_lapack", N, N, true), [&]{ QR_Lapack<N> q(a); do_not_optimize(q.get_R()); });
+	#endif
+}
+
+static void bench_decompositions_dynamic(Runner& r, int n)
+{
+	const Matrix<> spd = random_spd<Dynamic>(n);
+	const Matrix<> a = random_matrix<Dynamic,Dynamic>(n, n);
+	const Vector<> b = random_vector<Dynamic>(n);
+	Vector<> x(n);
+
+	r.run(sz("cholesky", n, n, false), [&]{ Cholesky<> c(spd); x = c.backsub(b); do_not_optimize(x); });
+	r.run(sz("qr", n, n, false), [&]{ QR<> q(a); do_not_optimize(q.get_R()); });
+	r.run(sz("gaussian_elimination", n, n, false), [&]{ x = gaussian_elimination(a, b); do_not_optimize(x); });
+	r.run(sz("determinant", n, n, false), [&]{ double d = determinant(a); do_not_optimize(d); });
+
+	#ifdef TOON_USE_LAPACK
+		r.run(sz("lapack_cholesky", n, n, false), [&]{ Lapack_Cholesky<Dynamic> c(spd); x = c.backsub(b); do_not_optimize(x); });
+		r.run(sz("lu", n, n, false), [&]{ LU<> l(a); x = l.backsub(b); do_not_optimize(x); });
+		r.run(sz("svd", n, n, false), [&]{ SVD<> s(a); x = s.backsub(b); do_not_optimize(x); });
+		r.run(sz("sym_eigen", n, n, false), [&]{ SymEigen<> e(spd); do_not_optimize(e.get_evalues()); });
+		r.run(sz("qr_lapack", n, n, false), [&]{ QR_Lapack<> q(a); do_not_optimize(q.get_R()); });
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Weighted least squares
+//
+
+template<int N> void bench_wls_fixed(Runner& r, int measurements)
+{
+	vector<Vector<N> > J;
+	vector<double> m;
+	for(int i=0; i < measurements; i++)
+	{
+		J.push_back(random_vector<N>());
+		m.push_back(rnd());
+	}
+
+	WLS<N> wls;
+	r.run(sz("wls_add_mJ", N, measurements, true), [&]{
+		wls.clear();
+		for(int i=0; i < measurements; i++)
+			wls.add_mJ(m[i], J[i]);
+		do_not_optimize(wls.get_C_inv());
+	});
+
+	r.run(sz("wls_compute", N, measurements, true), [&]{
+		wls.clear();
+		wls.add_prior(1);
+		for(int i=0; i < measurements; i++)
+			wls.add_mJ(m[i], J[i]);
+		wls.compute();
+		do_not_optimize(wls.get_mu());
+	});
+}
+
+static void bench_wls_dynamic(Runner& r, int n, int measurements)
+{
+	vector<Vector<> > J;
+	vector<double> m;
+	for(int i=0; i < measurements; i++)
+	{
+		J.push_back(random_vector<Dynamic>(n));
+		m.push_back(rnd());
+	}
+
+	WLS<> wls(n);
+	r.run(sz("wls_add_mJ", n, measurements, false), [&]{
+		wls.clear();
+		for(int i=0; i < measurements; i++)
+			wls.add_mJ(m[i], J[i]);
+		do_not_optimize(wls.get_C_inv());
+	});
+
+	r.run(sz("wls_compute", n, measurements, false), [&]{
+		wls.clear();
+		wls.add_prior(1);
+		for(int i=0; i < measurements; i++)
+			wls.add_mJ(m[i], J[i]);
+		wls.compute();
+		do_not_optimize(wls.get_mu());
+	});
+
+	//Static 2x6 blocks at run-time positions, as in bundle adjustment
+	if(n >= 12)
+	{
+		vector<Matrix<2,6> > J1, J2;
+		vector<Vector<2> > e;
+		vector<int> i1, i2;
+		for(int i=0; i < measurements; i++)
+		{
+			J1.push_back(random_matrix<2,6>());
+			J2.push_back(random_matrix<2,6>());
+			e.push_back(random_vector<2>());
+			i1.push_back(eng() % (n/6) * 6);
+			i2.push_back(eng() % (n/6) * 6);
+		}
+		const Matrix<2> invcov = Identity;
+
+		r.run(sz("wls_add_sparse_mJ_rows", n, measurements, false), [&]{
+			wls.clear();
+			for(int i=0; i < measurements; i++)
+				wls.add_sparse_mJ_rows(e[i], J1[i], i1[i], J2[i], i2[i], invcov);
+			do_not_optimize(wls.get_C_inv());
+		});
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// SE3
+//
+
+static void bench_se3(Runner& r)
+{
+	const Vector<6> mu = random_vector<6>();
+	const SE3<> pose = SE3<>::exp(mu);
+	const Vector<3> p = random_vector<3>();
+	SE3<> out;
+	Vector<6> v;
+	Vector<3> q;
+
+	r.run("se3/exp", [&]{ out = SE3<>::exp(mu); do_not_optimize(out); });
+	r.run("se3/ln", [&]{ v = pose.ln(); do_not_optimize(v); });
+	r.run("se3/transform_point", [&]{ q = pose * p; do_not_optimize(q); });
+	r.run("se3/compose", [&]{ out = pose * pose; do_not_optimize(out); });
+	r.run("se3/inverse", [&]{ out = pose.inverse(); do_not_optimize(out); });
+	r.run("se3/adjoint", [&]{ v = pose.adjoint(mu); do_not_optimize(v); });
+
+	//A rolling shutter trajectory: one pose per image row
+	CumulativeSpline<SE3<> > spline(0, 0.01);
+	for(int i=0; i < 8; i++)
+		spline.push_back(SE3<>::exp(random_vector<6>() * 0.1));
+	const double t = 0.025;
+	r.run("se3/interpolate", [&]{ out = interpolate(pose, spline.get_control(3), t); do_not_optimize(out); });
+	r.run("spline_se3/pose", [&]{ out = spline.pose(t); do_not_optimize(out); });
+	Vector<6> a;
+	r.run("spline_se3/evaluate", [&]{ spline.evaluate(t, out, v, a); do_not_optimize(a); });
+	Matrix<6, 24> jacobian;
+	r.run("spline_se3/pose_jacobian", [&]{ jacobian = spline.pose_jacobian(t); do_not_optimize(jacobian); });
+	Vector<> rows(1000);
+	for(int i=0; i < rows.size(); i++)
+		rows[i] = 0.02 + i * 0.00003;
+	std::vector<SE3<> > row_poses;
+	r.run("spline_se3/rows_1000", [&]{ spline.evaluate(rows, row_poses); do_not_optimize(row_poses); });
+
+	//Averaging noisy measurements of the same relative pose, as in rig calibration
+	std::vector<SE3<> > samples;
+	std::vector<SO3<> > rotations;
+	for(int i=0; i < 10000; i++) {
+		samples.push_back(pose * SE3<>::exp(random_vector<6>() * 0.01));
+		rotations.push_back(samples.back().get_rotation());
+	}
+	SO3<> mean_rotation;
+	r.run("so3/mean_10000", [&]{ mean_rotation = mean(rotations.begin(), rotations.end()); do_not_optimize(mean_rotation); });
+	r.run("se3/mean_10000", [&]{ out = mean(samples.begin(), samples.end()); do_not_optimize(out); });
+
+	//A pose graph of 100 nodes and 1000 relative rotations
+	std::vector<SO3<> > absolute;
+	for(int i=0; i < 100; i++)
+		absolute.push_back(SO3<>::exp(random_vector<3>()));
+	std::vector<RelativeRotation<> > edges;
+	for(int i=0; i < 1000; i++) {
+		const int from = i % 100, to = (from + 1 + i / 100) % 100;
+		edges.push_back({from, to, absolute[from].inverse() * absolute[to] * SO3<>::exp(random_vector<3>() * 0.01), 1.0});
+	}
+	std::vector<SO3<> > estimate;
+	r.run("so3/chordal_averaging_100x1000", [&]{ estimate = chordal_rotation_averaging(100, edges); do_not_optimize(estimate); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Matrix exponential, logarithm and square root
+//
+
+static void bench_matrix_functions(Runner& r, int n)
+{
+	const Vector<8> h = random_vector<8>() * 0.1;
+	SL<3> out;
+	r.run("sl3/exp", [&]{ out = SL<3>::exp(h); do_not_optimize(out); });
+	const SL<3> homography = SL<3>::exp(h);
+	Vector<8> v;
+	r.run("sl3/ln", [&]{ v = homography.ln(); do_not_optimize(v); });
+	const Vector<2> point = random_vector<2>();
+	Matrix<2, 8> jacobian;
+	r.run("sl3/point_jacobian", [&]{ jacobian = homography.point_jacobian(point); do_not_optimize(jacobian); });
+
+	const Vector<3> a2 = random_vector<3>() * 0.3;
+	SL<2> out2;
+	r.run("sl2/exp", [&]{ out2 = SL<2>::exp(a2); do_not_optimize(out2); });
+	const SL<2> affine = SL<2>::exp(a2);
+	Vector<3> v2;
+	r.run("sl2/ln", [&]{ v2 = affine.ln(); do_not_optimize(v2); });
+
+	const Matrix<3> a3 = random_matrix<3, 3>();
+	Matrix<3> e3;
+	r.run(sz("matrix_exp", 3, 3, true), [&]{ e3 = exp(a3); do_not_optimize(e3); });
+	const Matrix<3> spd3 = random_spd<3>();
+	r.run(sz("matrix_log", 3, 3, true), [&]{ e3 = log(spd3); do_not_optimize(e3); });
+	r.run(sz("matrix_sqrt", 3, 3, true), [&]{ e3 = sqrt(spd3); do_not_optimize(e3); });
+
+	Matrix<> a = random_matrix<Dynamic, Dynamic>(n, n) * (1.0 / n);
+	Matrix<> e(n, n);
+	r.run(sz("matrix_exp", n, n, false), [&]{ e = exp(a); do_not_optimize(e); });
+
+	MatrixExponential<> workspace(n);
+	r.run(sz("matrix_exp_workspace", n, n, false), [&]{ do_not_optimize(workspace.compute(a)); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Sparse matrices: the 5 point Laplacian on a grid
+//
+
+static void bench_sparse(Runner& r, int g)
+{
+	const int n = g*g;
+	std::vector<SparseEntry<> > entries;
+	for(int row=0; row < g; row++)
+		for(int col=0; col < g; col++)
+		{
+			const int i = row*g + col;
+			entries.push_back({i, i, 4.5});
+			if(row > 0) entries.push_back({i, i-g, -1});
+			if(row < g-1) entries.push_back({i, i+g, -1});
+			if(col > 0) entries.push_back({i, i-1, -1});
+			if(col < g-1) entries.push_back({i, i+1, -1});
+		}
+	const SparseMatrix<> L(n, n, entries);
+	const Vector<> x = random_vector<Dynamic>(n);
+	Vector<> y(n);
+
+	r.run(sz("sparse_mv", n, n, false), [&]{ y = L * x; do_not_optimize(y); });
+	r.run(sz("sparse_vm", n, n, false), [&]{ y = x * L; do_not_optimize(y); });
+
+	SparseCholesky<> chol;
+	r.run(sz("sparse_cholesky_analyze", n, n, false), [&]{ chol.analyze(L); do_not_optimize(chol); });
+	chol.analyze(L);
+	r.run(sz("sparse_cholesky_factorize", n, n, false), [&]{ chol.factorize(L); do_not_optimize(chol); });
+	r.run(sz("sparse_cholesky_backsub", n, n, false), [&]{ y = chol.backsub(x); do_not_optimize(y); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Optimizers
+//
+
+static double sq(double x)
+{
+	return x*x;
+}
+
+static double rosenbrock(const Vector<2>& v)
+{
+	return sq(1 - v[0]) + 100 * sq(v[1] - sq(v[0]));
+}
+
+static Vector<2> rosenbrock_derivatives(const Vector<2>& v)
+{
+	double x = v[0];
+	double y = v[1];
+	return makeVector(-2+2*x-400*(y-sq(x))*x, 200*y-200*sq(x));
+}
+
+static void bench_optimizers(Runner& r)
+{
+	r.run("optimize/conjugate_gradient/rosenbrock", [&]{
+		ConjugateGradient<2> cg(makeVector(0,0), rosenbrock, rosenbrock_derivatives);
+		while(cg.iterate(rosenbrock, rosenbrock_derivatives))
+		{}
+		do_not_optimize(cg.y);
+	});
+
+	r.run("optimize/downhill_simplex/rosenbrock", [&]{
+		DownhillSimplex<2> dh(rosenbrock, makeVector(-1, 1), 1);
+		while(dh.iterate(rosenbrock))
+		{}
+		do_not_optimize(dh.get_best());
+	});
+
+	auto f = [](double x){ return sq(x - 0.3) + 0.1 * std::cos(10*x); };
+	r.run("optimize/brent", [&]{
+		Vector<2> m = brent_line_search(-1.0, 0.2, 1.0, f(0.2), f, 100);
+		do_not_optimize(m);
+	});
+
+	r.run("optimize/golden_section", [&]{
+		Vector<2> m = golden_section_search(-1.0, 0.2, 1.0, f(0.2), f, 100);
+		do_not_optimize(m);
+	});
+}
+
+int main(int argc, char** argv)
+{
+	Options opts = parse_options(argc, argv);
+	Runner r(opts);
+	r.print_header(cout);
+
+	bench_products_fixed<2>(r);
+	bench_products_fixed<3>(r);
+	bench_products_fixed<4>(r);
+	bench_products_fixed<6>(r);
+	bench_products_fixed<12>(r);
+	bench_products_dynamic(r, 16);
+	bench_products_dynamic(r, 64);
+	bench_products_dynamic(r, 256);
+
+	bench_diagonal(r, 20);
+	bench_diagonal(r, 100);
+
+	bench_decompositions_fixed<3>(r);
+	bench_decompositions_fixed<6>(r);
+	bench_decompositions_dynamic(r, 20);
+	bench_decompositions_dynamic(r, 100);
+
+	bench_wls_fixed<6>(r, 100);
+	bench_wls_dynamic(r, 6, 100);
+	bench_wls_dynamic(r, 50, 200);
+
+	bench_sparse(r, 100);
+	bench_se3(r);
+	bench_matrix_functions(r, 20);
+	bench_optimizers(r);
+
+	return r.write_json()?0:1;
+}
@@ -0,0 +1,560 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_INCLUDE_BINARY_IO_H
+#define TOON_INCLUDE_BINARY_IO_H
+
+#include <TooN/TooN.h>
+#include <cstring>
+#include <climits>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#ifndef WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace TooN
+{
+
+///The header of the binary format written by save() and read by load().
+///
+///On disk, the header occupies the first BinaryHeader::bytes bytes and is
+///followed immediately by the elements in native byte order. The header is
+///padded so that the data is suitably aligned when the file is mapped in to
+///memory (see MappedMatrix).
+///@code
+///	offset  size  contents
+///	0       8     "TooNbin\n"
+///	8       4     version
+///	12      4     byte order marker, 0x01020304
+///	16      4     precision code
+///	20      4     sizeof(precision)
+///	24      4     flags: 1 = column major, 2 = vector
+///	32      8     rows
+///	40      8     columns
+///	48      16    zero
+///@endcode
+///@ingroup gLinAlg
+struct BinaryHeader
+{
+	static const int bytes = 64;                 ///< Size of the header on disk
+	static const std::uint32_t current_version=1;///< Version written by save()
+
+	std::uint32_t version;       ///< Version of the format
+	std::uint32_t precision;     ///< Code for the element type (see Internal::BinaryPrecision)
+	std::uint32_t element_size;  ///< Size of one element in bytes
+	bool column_major;           ///< Elements are stored column by column
+	bool is_vector;              ///< The data was saved from a Vector
+	std::uint64_t rows;          ///< Number of rows (the size, for a Vector)
+	std::uint64_t cols;          ///< Number of columns (1, for a Vector)
+};
+
+namespace Internal
+{
+	///@internal
+	///The code stored in BinaryHeader::precision for each type which can
+	///be saved. Unsupported types have a code of zero.
+	///@ingroup gInternal
+	template<class Precision> struct BinaryPrecision{ static const std::uint32_t value = 0; };
+	template<> struct BinaryPrecision<float>{ static const std::uint32_t value = 1; };
+	template<> struct BinaryPrecision<double>{ static const std::uint32_t value = 2; };
+	template<> struct BinaryPrecision<long double>{ static const std::uint32_t value = 3; };
+	template<> struct BinaryPrecision<std::complex<float> >{ static const std::uint32_t value = 4; };
+	template<> struct BinaryPrecision<std::complex<double> >{ static const std::uint32_t value = 5; };
+	template<> struct BinaryPrecision<std::complex<long double> >{ static const std::uint32_t value = 6; };
+	template<class Precision> struct BinaryPrecision<const Precision>: public BinaryPrecision<Precision>{};
+
+	static const char binary_magic[8] = {'T', 'o', 'o', 'N', 'b', 'i', 'n', '\n'};
+	static const std::uint32_t binary_byte_order = 0x01020304;
+
+	///@internal
+	///@ingroup gInternal
+	template<class Precision> BinaryHeader make_binary_header(int rows, int cols, bool column_major, bool is_vector)
+	{
+		static_assert(BinaryPrecision<Precision>::value != 0, "This precision can not be saved in the binary format.");
+		BinaryHeader h;
+		h.version = BinaryHeader::current_version;
+		h.precision = BinaryPrecision<Precision>::value;
+		h.element_size = sizeof(Precision);
+		h.column_major = column_major;
+		h.is_vector = is_vector;
+		h.rows = rows;
+		h.cols = cols;
+		return h;
+	}
+
+	///@internal
+	///Convert the header to its on disk form.
+	///@ingroup gInternal
+	inline void encode_binary_header(const BinaryHeader& h, char* buf)
+	{
+		std::uint32_t flags = (h.column_major?1:0) | (h.is_vector?2:0);
+		std::memset(buf, 0, BinaryHeader::bytes);
+		std::memcpy(buf, binary_magic, 8);
+		std::memcpy(buf + 8, &h.version, 4);
+		std::memcpy(buf + 12, &binary_byte_order, 4);
+		std::memcpy(buf + 16, &h.precision, 4);
+		std::memcpy(buf + 20, &h.element_size, 4);
+		std::memcpy(buf + 24, &flags, 4);
+		std::memcpy(buf + 32, &h.rows, 8);
+		std::memcpy(buf + 40, &h.cols, 8);
+	}
+
+	///@internal
+	///Convert the header from its on disk form. This fails if the data is not
+	///a TooN binary file, if it was written on a machine with a different byte
+	///order or by a newer version of TooN, or if the sizes are too large.
+	///@ingroup gInternal
+	inline bool decode_binary_header(const char* buf, BinaryHeader& h)
+	{
+		std::uint32_t order, flags;
+		if(std::memcmp(buf, binary_magic, 8) != 0)
+			return false;
+		std::memcpy(&h.version, buf + 8, 4);
+		std::memcpy(&order, buf + 12, 4);
+		std::memcpy(&h.precision, buf + 16, 4);
+		std::memcpy(&h.element_size, buf + 20, 4);
+		std::memcpy(&flags, buf + 24, 4);
+		std::memcpy(&h.rows, buf + 32, 8);
+		std::memcpy(&h.cols, buf + 40, 8);
+		h.column_major = flags & 1;
+		h.is_vector = flags & 2;
+
+		return order == binary_byte_order && h.version <= BinaryHeader::current_version && h.version > 0
+		       && h.rows <= INT_MAX && h.cols <= INT_MAX && (h.cols == 0 || h.rows <= INT_MAX / h.cols);
+	}
+
+	///@internal
+	///Does the header describe elements of the given type?
+	///@ingroup gInternal
+	template<class Precision> bool binary_precision_matches(const BinaryHeader& h)
+	{
+		static_assert(BinaryPrecision<Precision>::value != 0, "This precision can not be loaded from the binary format.");
+		return h.precision == BinaryPrecision<Precision>::value && h.element_size == sizeof(Precision);
+	}
+
+	///@internal
+	///Read a header for data of the given type. On failure, failbit is set.
+	///@ingroup gInternal
+	template<class Precision> bool read_binary_header(std::istream& is, BinaryHeader& h)
+	{
+		char buf[BinaryHeader::bytes];
+		if(is.read(buf, BinaryHeader::bytes) && decode_binary_header(buf, h) && binary_precision_matches<Precision>(h))
+			return true;
+
+		is.setstate(std::ios::failbit);
+		return false;
+	}
+
+	///@internal
+	///Number of elements buffered by write_binary_elements and read_binary_elements.
+	///@ingroup gInternal
+	static const int binary_chunk = 256;
+
+	///@internal
+	///Write outer*inner elements in order, obtaining them from get(i, j).
+	///The elements pass through a small buffer so that non contiguous data
+	///does not need a write call per element.
+	///@ingroup gInternal
+	template<class Precision, class Get> void write_binary_elements(std::ostream& os, int outer, int inner, const Get& get)
+	{
+		Precision buf[binary_chunk];
+		int n=0;
+		for(int i=0; i < outer; i++)
+			for(int j=0; j < inner; j++)
+			{
+				buf[n++] = get(i, j);
+				if(n == binary_chunk)
+				{
+					os.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+					n=0;
+				}
+			}
+		os.write(reinterpret_cast<const char*>(buf), sizeof(Precision) * n);
+	}
+
+	///@internal
+	///Read outer*inner elements, storing them with set(i, j, value).
+	///@ingroup gInternal
+	template<class Precision, class Set> void read_binary_elements(std::istream& is, int outer, int inner, const Set& set)
+	{
+		Precision buf[binary_chunk];
+		const long long total = (long long)outer * inner;
+		long long done = 0;
+		while(done < total && is)
+		{
+			int n = (int)std::min<long long>(binary_chunk, total - done);
+			if(!is.read(reinterpret_cast<char*>(buf), sizeof(Precision)*n))
+				return;
+
+			for(int k=0; k < n; k++, done++)
+				set((int)(done / inner), (int)(done % inner), buf[k]);
+		}
+	}
+
+	///@internal
+	///Is the matrix stored contiguously, in row major (or column major) order?
+	///@ingroup gInternal
+	template<class M> bool is_contiguous(const M& m, bool column_major)
+	{
+		if(column_major)
+			return (m.rowstride() == 1 || m.num_rows() <= 1) && (m.colstride() == m.num_rows() || m.num_cols() <= 1);
+		else
+			return (m.colstride() == 1 || m.num_cols() <= 1) && (m.rowstride() == m.num_cols() || m.num_rows() <= 1);
+	}
+
+	///@internal
+	///Read the elements described by the header in to a matrix of the same size.
+	///@ingroup gInternal
+	template<int R, int C, class P, class L> void read_binary_matrix(std::istream& is, const BinaryHeader& h, Matrix<R, C, P, L>& m)
+	{
+		if(m.num_rows() == 0 || m.num_cols() == 0)
+			return;
+
+		if(is_contiguous(m, h.column_major))
+			is.read(reinterpret_cast<char*>(&m(0,0)), sizeof(P) * m.num_rows() * m.num_cols());
+		else if(h.column_major)
+			read_binary_elements<P>(is, m.num_cols(), m.num_rows(), [&](int c, int r, const P& x){ m(r,c) = x; });
+		else
+			read_binary_elements<P>(is, m.num_rows(), m.num_cols(), [&](int r, int c, const P& x){ m(r,c) = x; });
+	}
+}
+
+///Read the header of a file written by save(), leaving the stream positioned
+///at the start of the data. If the stream does not contain a header which
+///this version of TooN understands, failbit is set.
+///@ingroup gLinAlg
+inline std::istream& read_header(std::istream& is, BinaryHeader& h)
+{
+	char buf[BinaryHeader::bytes];
+	if(is.read(buf, BinaryHeader::bytes) && !Internal::decode_binary_header(buf, h))
+		is.setstate(std::ios::failbit);
+	return is;
+}
+
+///Write a vector to a stream in the binary format described by BinaryHeader.
+///The stream should be opened in binary mode.
+///@ingroup gLinAlg
+template<int Size, class Precision, class Base> std::ostream& save(std::ostream& os, const Vector<Size, Precision, Base>& v)
+{
+	char buf[BinaryHeader::bytes];
+	Internal::encode_binary_header(Internal::make_binary_header<Precision>(v.size(), 1, false, true), buf);
+	os.write(buf, BinaryHeader::bytes);
+
+	if(v.size() == 0)
+		return os;
+
+	if(v.stride() == 1)
+		os.write(reinterpret_cast<const char*>(&v[0]), sizeof(Precision) * v.size());
+	else
+		Internal::write_binary_elements<Precision>(os, v.size(), 1, [&](int i, int){ return v[i]; });
+	return os;
+}
+
+///Write a matrix to a stream in the binary format described by BinaryHeader.
+///Column major matrices are written in column major order, and everything
+///else in row major order. The stream should be opened in binary mode.
+///@ingroup gLinAlg
+template<int Rows, int Cols, class Precision, class Layout> std::ostream& save(std::ostream& os, const Matrix<Rows, Cols, Precision, Layout>& m)
+{
+	const bool column_major = !Internal::is_contiguous(m, false) && Internal::is_contiguous(m, true);
+
+	char buf[BinaryHeader::bytes];
+	Internal::encode_binary_header(Internal::make_binary_header<Precision>(m.num_rows(), m.num_cols(), column_major, false), buf);
+	os.write(buf, BinaryHeader::bytes);
+
+	if(m.num_rows() == 0 || m.num_cols() == 0)
+		return os;
+
+	if(column_major || Internal::is_contiguous(m, false))
+		os.write(reinterpret_cast<const char*>(&m(0,0)), sizeof(Precision) * m.num_rows() * m.num_cols());
+	else
+		Internal::write_binary_elements<Precision>(os, m.num_rows(), m.num_cols(), [&](int r, int c){ return m(r,c); });
+	return os;
+}
+
+///Read a vector written by save(). Resizable and Bounded vectors are resized
+///to fit the data. Otherwise, the size of the vector must match the size of the
+///data. On any error, including a mismatch in size or precision, failbit is
+///set and the contents of the vector are unspecified.
+///@ingroup gLinAlg
+template<int Size, class Precision, class Base> std::istream& load(std::istream& is, Vector<Size, Precision, Base>& v)
+{
+	BinaryHeader h;
+	if(!Internal::read_binary_header<Precision>(is, h))
+		return is;
+
+	const int capacity = Internal::VectorCapacity<Base>::value;
+	if(h.cols == 1 && (capacity == 0 || h.rows <= (std::uint64_t)capacity))
+		v.try_destructive_resize((int)h.rows);
+
+	if(h.cols != 1 || v.size() != (int)h.rows)
+	{
+		is.setstate(std::ios::failbit);
+		return is;
+	}
+
+	if(v.size() == 0)
+		return is;
+
+	if(v.stride() == 1)
+		is.read(reinterpret_cast<char*>(&v[0]), sizeof(Precision) * v.size());
+	else
+		Internal::read_binary_elements<Precision>(is, v.size(), 1, [&](int i, int, const Precision& x){ v[i] = x; });
+	return is;
+}
+
+///Read a matrix written by save(). The size of the matrix must match the size
+///of the data, which may be stored in either row or column major order.
+///On any error, failbit is set and the contents of the matrix are unspecified.
+///@ingroup gLinAlg
+template<int Rows, int Cols, class Precision, class Layout> std::istream& load(std::istream& is, Matrix<Rows, Cols, Precision, Layout>& m)
+{
+	BinaryHeader h;
+	if(!Internal::read_binary_header<Precision>(is, h))
+		return is;
+
+	if(h.rows != (std::uint64_t)m.num_rows() || h.cols != (std::uint64_t)m.num_cols())
+	{
+		is.setstate(std::ios::failbit);
+		return is;
+	}
+
+	Internal::read_binary_matrix(is, h, m);
+	return is;
+}
+
+///Read a matrix of any size written by save(). On error, failbit is set and an
+///empty matrix is returned.
+///@code
+///	std::ifstream f("basis.toon", std::ios::binary);
+///	Matrix<> basis = load_matrix(f);
+///@endcode
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision> Matrix<Dynamic, Dynamic, Precision> load_matrix(std::istream& is)
+{
+	BinaryHeader h;
+	const bool ok = Internal::read_binary_header<Precision>(is, h);
+
+	Matrix<Dynamic, Dynamic, Precision> m(ok?(int)h.rows:0, ok?(int)h.cols:0);
+	if(ok)
+		Internal::read_binary_matrix(is, h, m);
+	return m;
+}
+
+#ifndef WIN32
+
+namespace Internal
+{
+	///@internal
+	///A read only mapping of a file written by save().
+	///@ingroup gInternal
+	class MappedBinaryFile
+	{
+		public:
+			template<class Precision>
+			MappedBinaryFile(const std::string& filename, Precision*)
+			:base(0), length(0), h()
+			{
+				int fd = open(filename.c_str(), O_RDONLY);
+				if(fd == -1)
+					return;
+
+				struct stat s;
+				if(fstat(fd, &s) == 0 && s.st_size >= BinaryHeader::bytes)
+				{
+					void* p = mmap(0, s.st_size, PROT_READ, MAP_SHARED, fd, 0);
+					if(p != MAP_FAILED)
+					{
+						base = static_cast<const char*>(p);
+						length = s.st_size;
+					}
+				}
+				close(fd);
+
+				if(base && !(decode_binary_header(base, h) && binary_precision_matches<Precision>(h)
+				             && (std::uint64_t)length >= BinaryHeader::bytes + h.rows * h.cols * sizeof(Precision)))
+					unmap();
+			}
+
+			MappedBinaryFile(MappedBinaryFile&& f)
+			:base(f.base), length(f.length), h(f.h)
+			{
+				f.base = 0;
+			}
+
+			MappedBinaryFile(const MappedBinaryFile&) = delete;
+			MappedBinaryFile& operator=(const MappedBinaryFile&) = delete;
+
+			~MappedBinaryFile()
+			{
+				unmap();
+			}
+
+			bool is_open() const
+			{
+				return base != 0;
+			}
+
+			const BinaryHeader& header() const
+			{
+				return h;
+			}
+
+			const void* data() const
+			{
+				return base + BinaryHeader::bytes;
+			}
+
+		private:
+			void unmap()
+			{
+				if(base)
+					munmap(const_cast<char*>(base), length);
+				base = 0;
+			}
+
+			const char* base;
+			std::size_t length;
+			BinaryHeader h;
+	};
+
+	///@internal
+	///Is the Reference layout column major?
+	///@ingroup gInternal
+	template<class Layout> struct ReferenceIsColMajor{ static const bool value = false; };
+	template<> struct ReferenceIsColMajor<Reference::ColMajor>{ static const bool value = true; };
+}
+
+///A read only matrix stored in a file written by save(), which is mapped in to
+///memory rather than read. Opening the file is immediate and the data is never
+///copied: pages are read from the disk by the operating system as the matrix
+///is accessed.
+///
+///The precision must match the file. The Layout must be Reference::RowMajor
+///or Reference::ColMajor, and it must match the order in which the data was
+///saved. If the file can not be mapped or does not match, is_open() is false
+///and the matrix is empty.
+///@code
+///	MappedMatrix<> basis("basis.toon");
+///	if(!basis.is_open())
+///		...
+///	Vector<> c = basis.matrix() * x;
+///@endcode
+///This is only available on POSIX systems.
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision, class Layout=Reference::RowMajor> class MappedMatrix
+{
+	public:
+		///Map the file.
+		explicit MappedMatrix(const std::string& filename)
+		:file(filename, static_cast<Precision*>(0))
+		{
+			ok = file.is_open() && file.header().column_major == Internal::ReferenceIsColMajor<Layout>::value;
+		}
+
+		///Was the file mapped successfully?
+		bool is_open() const
+		{
+			return ok;
+		}
+
+		///The header of the file.
+		const BinaryHeader& header() const
+		{
+			return file.header();
+		}
+
+		///The data in the file, as a matrix. This remains valid for as long as
+		///the MappedMatrix exists.
+		Matrix<Dynamic, Dynamic, const Precision, Layout> matrix() const
+		{
+			if(ok)
+				return Matrix<Dynamic, Dynamic, const Precision, Layout>(static_cast<const Precision*>(file.data()), (int)file.header().rows, (int)file.header().cols);
+			else
+				return Matrix<Dynamic, Dynamic, const Precision, Layout>(static_cast<const Precision*>(0), 0, 0);
+		}
+
+	private:
+		Internal::MappedBinaryFile file;
+		bool ok;
+};
+
+///A read only vector stored in a file written by save(), which is mapped in to
+///memory rather than read. See MappedMatrix.
+///This is only available on POSIX systems.
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision> class MappedVector
+{
+	public:
+		///Map the file.
+		explicit MappedVector(const std::string& filename)
+		:file(filename, static_cast<Precision*>(0))
+		{
+			ok = file.is_open() && file.header().cols == 1;
+		}
+
+		///Was the file mapped successfully?
+		bool is_open() const
+		{
+			return ok;
+		}
+
+		///The header of the file.
+		const BinaryHeader& header() const
+		{
+			return file.header();
+		}
+
+		///The data in the file, as a vector. This remains valid for as long as
+		///the MappedVector exists.
+		Vector<Dynamic, const Precision, Reference> vector() const
+		{
+			if(ok)
+				return Vector<Dynamic, const Precision, Reference>(static_cast<const Precision*>(file.data()), (int)file.header().rows);
+			else
+				return Vector<Dynamic, const Precision, Reference>(static_cast<const Precision*>(0), 0);
+		}
+
+	private:
+		Internal::MappedBinaryFile file;
+		bool ok;
+};
+
+#endif
+
+}
+
+#endif
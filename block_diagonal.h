@@ -0,0 +1,310 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+#ifndef TOON_INCLUDE_BLOCK_DIAGONAL_H
+#define TOON_INCLUDE_BLOCK_DIAGONAL_H
+
+#include <TooN/TooN.h>
+#include <TooN/Cholesky.h>
+#include <vector>
+
+namespace TooN {
+
+/**
+@class BlockDiagonalMatrix
+A square matrix made of square blocks of size BlockSize along the diagonal,
+with zeros elsewhere. Only the blocks are stored, so the storage and the cost
+of a matrix-vector product grow linearly with the number of blocks. This is
+the structure of the normal equations of problems with many independent
+parameter groups, such as per-landmark positions:
+@code
+BlockDiagonalMatrix<3> A(landmarks);
+A = Zeros;
+for(...)
+	A.add_sparse_JtWJ(J, 3*landmark, invcov);  //J is N x 3
+
+BlockDiagonalCholesky<3> chol(A);
+Vector<> x = chol.backsub(b);
+@endcode
+@ingroup gLinAlg
+**/
+template<int BlockSize, class Precision=DefaultPrecision>
+class BlockDiagonalMatrix
+{
+	static_assert(BlockSize > 0, "BlockDiagonalMatrix needs a static, positive BlockSize");
+
+	public:
+		///The type of one of the blocks.
+		typedef Matrix<BlockSize, BlockSize, Precision, Internal::Slice<BlockSize, 1> > Block;
+		///The type of one of the blocks.
+		typedef Matrix<BlockSize, BlockSize, const Precision, Internal::Slice<BlockSize, 1> > ConstBlock;
+
+		///Construct an uninitialized matrix with the given number of blocks.
+		explicit BlockDiagonalMatrix(int blocks)
+		:my_blocks(blocks*BlockSize, BlockSize)
+		{}
+
+		///@name Assignment
+		///@{
+
+		///Set all elements to zero.
+		BlockDiagonalMatrix& operator=(const Operator<Internal::Zero>&)
+		{
+			my_blocks = Zeros;
+			return *this;
+		}
+
+		///Set the matrix to a multiple of the identity.
+		template<class P>
+		BlockDiagonalMatrix& operator=(const Operator<Internal::Identity<P> >& op)
+		{
+			for(int i=0; i < num_blocks(); i++)
+				block(i) = op;
+			return *this;
+		}
+		///@}
+
+		///@name Access
+		///@{
+
+		///The number of blocks.
+		int num_blocks() const
+		{
+			return my_blocks.num_rows() / BlockSize;
+		}
+
+		///The number of rows (and columns).
+		int size() const
+		{
+			return my_blocks.num_rows();
+		}
+
+		///The number of rows.
+		int num_rows() const
+		{
+			return size();
+		}
+
+		///The number of columns.
+		int num_cols() const
+		{
+			return size();
+		}
+
+		///Block i, which covers rows and columns i*BlockSize to (i+1)*BlockSize-1.
+		Block block(int i)
+		{
+			return my_blocks.template slice<Dynamic, 0, BlockSize, BlockSize>(i*BlockSize, 0, BlockSize, BlockSize);
+		}
+
+		///Block i, which covers rows and columns i*BlockSize to (i+1)*BlockSize-1.
+		ConstBlock block(int i) const
+		{
+			return my_blocks.template slice<Dynamic, 0, BlockSize, BlockSize>(i*BlockSize, 0, BlockSize, BlockSize);
+		}
+
+		///Return element (r, c), which is zero outside the blocks.
+		Precision operator()(int r, int c) const
+		{
+			Internal::check_index(size(), r);
+			Internal::check_index(size(), c);
+			if(r / BlockSize != c / BlockSize)
+				return 0;
+			return my_blocks(r, c % BlockSize);
+		}
+
+		///The blocks, stacked vertically.
+		const Matrix<Dynamic, BlockSize, Precision>& blocks() const
+		{
+			return my_blocks;
+		}
+
+		///Expand the matrix to a full matrix.
+		Matrix<Dynamic, Dynamic, Precision> dense() const
+		{
+			Matrix<Dynamic, Dynamic, Precision> m = Zeros(size(), size());
+			for(int i=0; i < num_blocks(); i++)
+				m.slice(i*BlockSize, i*BlockSize, BlockSize, BlockSize) = block(i);
+			return m;
+		}
+		///@}
+
+		///Add \f$J^\mathsf{T}WJ\f$ at the parameters starting at index, in the same
+		///way as WLS::add_sparse_mJ_rows. The parameters J refers to must all lie
+		///in the same block.
+		///@param J The Jacobian of the measurements with respect to the parameters
+		///@param index The first parameter J refers to
+		///@param invcov The inverse covariance of the measurements
+		template<int N, int S, class P1, class B1, class P2, class B2>
+		void add_sparse_JtWJ(const Matrix<N, S, P1, B1>& J, int index, const Matrix<N, N, P2, B2>& invcov)
+		{
+			Internal::check_index(size(), index);
+			Internal::check_index(BlockSize, index % BlockSize + J.num_cols() - 1);
+			const Matrix<S, N, Precision> temp = J.T() * invcov;
+			my_blocks.slice(index, index % BlockSize, J.num_cols(), J.num_cols()) += temp * J;
+		}
+
+	private:
+		Matrix<Dynamic, BlockSize, Precision> my_blocks;
+};
+
+///Write a matrix to a stream, in the same form as a Matrix.
+///@relates BlockDiagonalMatrix
+template<int BlockSize, class P>
+std::ostream& operator<<(std::ostream& os, const BlockDiagonalMatrix<BlockSize, P>& m)
+{
+	return os << m.dense();
+}
+
+///Multiply a block diagonal matrix by a vector, one block at a time.
+///@relates BlockDiagonalMatrix
+template<int BlockSize, class P1, int S, class P2, class B2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const BlockDiagonalMatrix<BlockSize, P1>& m, const Vector<S, P2, B2>& v)
+{
+	SizeMismatch<Dynamic, S>::test(m.size(), v.size());
+	TOON_INSTRUMENT_OPERATION("block diagonal * vector", 2.0*m.size()*BlockSize);
+	Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> r(m.size());
+	for(int i=0; i < m.num_blocks(); i++)
+		r.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize) = m.block(i) * v.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize);
+	return r;
+}
+
+///Multiply a vector by a block diagonal matrix, one block at a time.
+///@relates BlockDiagonalMatrix
+template<int S, class P1, class B1, int BlockSize, class P2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const Vector<S, P1, B1>& v, const BlockDiagonalMatrix<BlockSize, P2>& m)
+{
+	SizeMismatch<S, Dynamic>::test(v.size(), m.size());
+	TOON_INSTRUMENT_OPERATION("vector * block diagonal", 2.0*m.size()*BlockSize);
+	Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> r(m.size());
+	for(int i=0; i < m.num_blocks(); i++)
+		r.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize) = v.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize) * m.block(i);
+	return r;
+}
+
+/**
+Cholesky decomposition of a symmetric positive definite BlockDiagonalMatrix,
+computed one block at a time with Cholesky. The run time is
+\f$O(nB^2)\f$ for n parameters in blocks of size B, rather than
+\f$O(n^3)\f$ for the equivalent dense matrix. As with Cholesky, only the lower
+half of each block is considered.
+@code
+BlockDiagonalCholesky<3> chol(A);
+Vector<> x = chol.backsub(b);
+@endcode
+@ingroup gDecomps
+**/
+template<int BlockSize, class Precision=DefaultPrecision>
+class BlockDiagonalCholesky
+{
+	public:
+		///Construct an empty decomposition with the given number of blocks.
+		explicit BlockDiagonalCholesky(int blocks=0)
+		:my_blocks(blocks)
+		{}
+
+		///Construct the decomposition of a matrix.
+		template<class P2>
+		BlockDiagonalCholesky(const BlockDiagonalMatrix<BlockSize, P2>& m)
+		{
+			compute(m);
+		}
+
+		///Compute the decomposition of another matrix.
+		template<class P2>
+		void compute(const BlockDiagonalMatrix<BlockSize, P2>& m)
+		{
+			TOON_INSTRUMENT_TIMED_OPERATION("Block diagonal Cholesky", m.num_blocks()*(double)BlockSize*BlockSize*BlockSize/3);
+			my_blocks.resize(m.num_blocks());
+			for(int i=0; i < m.num_blocks(); i++)
+				my_blocks[i].compute(m.block(i));
+		}
+
+		///The number of blocks.
+		int num_blocks() const
+		{
+			return my_blocks.size();
+		}
+
+		///The number of rows (and columns) of the decomposed matrix.
+		int size() const
+		{
+			return num_blocks() * BlockSize;
+		}
+
+		///The decomposition of block i.
+		const Cholesky<BlockSize, Precision>& block(int i) const
+		{
+			return my_blocks[i];
+		}
+
+		///Compute \f$M^{-1}v\f$.
+		template<int S, class P2, class B2>
+		Vector<Dynamic, Precision> backsub(const Vector<S, P2, B2>& v) const
+		{
+			SizeMismatch<Dynamic, S>::test(size(), v.size());
+			Vector<Dynamic, Precision> x(size());
+			for(int i=0; i < num_blocks(); i++)
+				x.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize) = my_blocks[i].backsub(v.template slice<Dynamic, BlockSize>(i*BlockSize, BlockSize));
+			return x;
+		}
+
+		///Compute the inverse, which is also block diagonal.
+		BlockDiagonalMatrix<BlockSize, Precision> get_inverse() const
+		{
+			BlockDiagonalMatrix<BlockSize, Precision> m(num_blocks());
+			for(int i=0; i < num_blocks(); i++)
+				m.block(i) = my_blocks[i].backsub(Matrix<BlockSize, BlockSize, Precision>(Identity));
+			return m;
+		}
+
+		///Compute the determinant.
+		Precision determinant() const
+		{
+			Precision d = 1;
+			for(int i=0; i < num_blocks(); i++)
+				d *= my_blocks[i].determinant();
+			return d;
+		}
+
+		///The rank of the decomposed matrix. It is less than size() if any
+		///block is singular.
+		int rank() const
+		{
+			int r = 0;
+			for(int i=0; i < num_blocks(); i++)
+				r += my_blocks[i].rank();
+			return r;
+		}
+
+	private:
+		std::vector<Cholesky<BlockSize, Precision> > my_blocks;
+};
+
+}
+
+#endif
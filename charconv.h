@@ -0,0 +1,510 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_INCLUDE_CHARCONV_H
+#define TOON_INCLUDE_CHARCONV_H
+
+#include <TooN/TooN.h>
+#include <TooN/se3.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <string>
+#include <vector>
+
+//Use std::from_chars and std::to_chars if the library provides them for
+//floating point types. Otherwise fall back to the C library.
+#if !defined TOON_NO_CHARCONV && __cplusplus >= 201703L && defined __has_include
+	#if __has_include(<charconv>)
+		#include <charconv>
+		#if defined __cpp_lib_to_chars && __cpp_lib_to_chars >= 201611L
+			#define TOON_FLOAT_CHARCONV
+		#endif
+	#endif
+#endif
+
+namespace TooN
+{
+
+namespace Internal
+{
+	///@internal
+	///Is the character a separator between numbers? Whitespace and commas
+	///are both accepted, so whitespace and CSV data can be read.
+	///@ingroup gInternal
+	inline bool is_number_separator(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == '\v' || c == '\f';
+	}
+
+	///@internal
+	///@ingroup gInternal
+	inline const char* skip_number_separators(const char* p, const char* last)
+	{
+		while(p != last && is_number_separator(*p))
+			++p;
+		return p;
+	}
+
+	#ifndef TOON_FLOAT_CHARCONV
+		inline void c_strto(const char* s, char** end, float& x){ x = std::strtof(s, end); }
+		inline void c_strto(const char* s, char** end, double& x){ x = std::strtod(s, end); }
+		inline void c_strto(const char* s, char** end, long double& x){ x = std::strtold(s, end); }
+		inline int c_snprintf(char* buf, int n, int digits, float x){ return std::snprintf(buf, n, "%.*g", digits, (double)x); }
+		inline int c_snprintf(char* buf, int n, int digits, double x){ return std::snprintf(buf, n, "%.*g", digits, x); }
+		inline int c_snprintf(char* buf, int n, int digits, long double x){ return std::snprintf(buf, n, "%.*Lg", digits, x); }
+
+		///@internal
+		///The decimal point which the C library uses in the current locale.
+		///@ingroup gInternal
+		inline std::string c_decimal_point()
+		{
+			const char* p = std::localeconv()->decimal_point;
+			return (p && *p) ? p : ".";
+		}
+
+		///@internal
+		///Parse a terminated string with the C library. Numbers are always
+		///written with '.', so it is replaced by the locale's decimal point first.
+		///@ingroup gInternal
+		template<class Precision> void c_parse(const char* s, char** end, Precision& x)
+		{
+			const std::string point = c_decimal_point();
+			if(point == ".")
+			{
+				c_strto(s, end, x);
+				return;
+			}
+
+			std::string local;
+			for(const char* p = s; *p; ++p)
+				if(*p == '.')
+					local += point;
+				else
+					local += *p;
+
+			char* local_end;
+			c_strto(local.c_str(), &local_end, x);
+
+			//Find the end in the original string
+			const size_t used = local_end - local.c_str();
+			const char* q = s;
+			for(size_t n=0; *q; ++q)
+			{
+				n += (*q == '.') ? point.size() : 1;
+				if(n > used)
+					break;
+			}
+			*end = const_cast<char*>(q);
+		}
+
+		///@internal
+		///Format a number with the C library, replacing the locale's decimal
+		///point with '.'.
+		///@ingroup gInternal
+		template<class Precision> int c_format(char* buf, int n, int digits, Precision x)
+		{
+			int r = c_snprintf(buf, n, digits, x);
+			const std::string point = c_decimal_point();
+			if(r < 0 || r >= n || point == ".")
+				return r;
+
+			char* p = std::strstr(buf, point.c_str());
+			if(p)
+			{
+				*p = '.';
+				std::memmove(p + 1, p + point.size(), std::strlen(p + point.size()) + 1);
+				r -= point.size() - 1;
+			}
+			return r;
+		}
+	#endif
+
+	///@internal
+	///Parse a single number starting exactly at first. Returns the character
+	///after the number or 0 on failure. Both implementations accept the same
+	///numbers: an optional leading '+' is allowed, and hexadecimal is not.
+	///@ingroup gInternal
+	template<class Precision> const char* parse_number(const char* first, const char* last, Precision& x)
+	{
+		#ifdef TOON_FLOAT_CHARCONV
+			//from_chars does not accept a leading '+', unlike strtod.
+			if(first != last && *first == '+' && first + 1 != last && first[1] != '-')
+				++first;
+
+			std::from_chars_result r = std::from_chars(first, last, x);
+			return r.ec == std::errc() ? r.ptr : 0;
+		#else
+			//The C library needs a terminated string. Stopping at an 'x'
+			//leaves only the leading 0 of a hexadecimal number, as from_chars
+			//would read.
+			char buf[128];
+			int n=0;
+			while(first + n != last && !is_number_separator(first[n]) && first[n] != 'x' && first[n] != 'X' && n < (int)sizeof(buf)-1)
+			{
+				buf[n] = first[n];
+				n++;
+			}
+			buf[n] = 0;
+
+			char* end;
+			c_parse(buf, &end, x);
+			return (end == buf) ? 0 : first + (end - buf);
+		#endif
+	}
+
+	///@internal
+	///Write a single number in the shortest form which reads back exactly.
+	///Returns the character after the number or 0 if there is not enough space.
+	///@ingroup gInternal
+	template<class Precision> char* format_number(char* first, char* last, const Precision& x)
+	{
+		#ifdef TOON_FLOAT_CHARCONV
+			std::to_chars_result r = std::to_chars(first, last, x);
+			return r.ec == std::errc() ? r.ptr : 0;
+		#else
+			//Try increasing numbers of digits until the number round trips.
+			char buf[64];
+			int n=0;
+			for(int digits = std::numeric_limits<Precision>::digits10; digits <= std::numeric_limits<Precision>::max_digits10; digits++)
+			{
+				n = c_format(buf, sizeof(buf), digits, x);
+				Precision y;
+				char* end;
+				c_parse(buf, &end, y);
+				if(y == x || x != x)
+					break;
+			}
+
+			if(n < 0 || n > last - first)
+				return 0;
+			std::memcpy(first, buf, n);
+			return first + n;
+		#endif
+	}
+
+	///@internal
+	///Write a single character.
+	///@ingroup gInternal
+	inline char* format_char(char* first, char* last, char c)
+	{
+		if(first == 0 || first == last)
+			return 0;
+		*first = c;
+		return first + 1;
+	}
+}
+
+///Parse the elements of a vector from text, without using iostreams or the
+///locale. The numbers may be separated by any mixture of whitespace and commas,
+///and leading separators are skipped.
+///@param first Start of the text
+///@param last  End of the text
+///@param v     Vector to fill. All of its elements are read.
+///@return The position after the last element, or 0 if the text does not
+///        contain enough valid numbers.
+///@code
+///	std::string s = "1.5, 2, 3e-4";
+///	Vector<3> v;
+///	from_chars(s.data(), s.data() + s.size(), v);
+///@endcode
+///@ingroup gLinAlg
+template<int Size, class Precision, class Base> const char* from_chars(const char* first, const char* last, Vector<Size, Precision, Base>& v)
+{
+	for(int i=0; i < v.size() && first; i++)
+		first = Internal::parse_number(Internal::skip_number_separators(first, last), last, v[i]);
+	return first;
+}
+
+///Parse the elements of a matrix from text, in row major order.
+///See from_chars(const char*, const char*, Vector<Size, Precision, Base>&).
+///@ingroup gLinAlg
+template<int Rows, int Cols, class Precision, class Layout> const char* from_chars(const char* first, const char* last, Matrix<Rows, Cols, Precision, Layout>& m)
+{
+	for(int r=0; r < m.num_rows() && first; r++)
+		for(int c=0; c < m.num_cols() && first; c++)
+			first = Internal::parse_number(Internal::skip_number_separators(first, last), last, m(r,c));
+	return first;
+}
+
+///Parse an SO3 from text, in the same format as operator>>: the rotation
+///matrix in row major order. The matrix is coerced to be a rotation.
+///@ingroup gLinAlg
+template<class Precision> const char* from_chars(const char* first, const char* last, SO3<Precision>& rot)
+{
+	Matrix<3, 3, Precision> m;
+	first = from_chars(first, last, m);
+	if(first)
+		rot = m;
+	return first;
+}
+
+///Parse an SE3 from text, in the same format as operator>>: three rows, each
+///of a row of the rotation matrix followed by an element of the translation.
+///The rotation is coerced to be a rotation.
+///@ingroup gLinAlg
+template<class Precision> const char* from_chars(const char* first, const char* last, SE3<Precision>& pose)
+{
+	Matrix<3, 4, Precision> m;
+	first = from_chars(first, last, m);
+	if(first)
+	{
+		pose.get_rotation() = m.template slice<0, 0, 3, 3>();
+		pose.get_translation() = m.T()[3];
+	}
+	return first;
+}
+
+///Format the elements of a vector as text, without using iostreams or the
+///locale. Each number is written in the shortest form which reads back to
+///exactly the same value.
+///@param first Start of the output buffer
+///@param last  End of the output buffer
+///@param v     Vector to write
+///@param separator Character written between elements
+///@return The position after the last character written, or 0 if the buffer
+///        is too small. The output is not terminated.
+///@ingroup gLinAlg
+template<int Size, class Precision, class Base> char* to_chars(char* first, char* last, const Vector<Size, Precision, Base>& v, char separator=' ')
+{
+	for(int i=0; i < v.size() && first; i++)
+	{
+		if(i != 0)
+			first = Internal::format_char(first, last, separator);
+		if(first)
+			first = Internal::format_number(first, last, v[i]);
+	}
+	return first;
+}
+
+///Format the elements of a matrix as text. Elements are separated by the
+///separator and every row, including the last, ends with a newline.
+///See to_chars(char*, char*, const Vector<Size, Precision, Base>&, char).
+///@ingroup gLinAlg
+template<int Rows, int Cols, class Precision, class Layout> char* to_chars(char* first, char* last, const Matrix<Rows, Cols, Precision, Layout>& m, char separator=' ')
+{
+	for(int r=0; r < m.num_rows() && first; r++)
+	{
+		first = to_chars(first, last, m[r], separator);
+		first = Internal::format_char(first, last, '\n');
+	}
+	return first;
+}
+
+///Format an SO3 as text, in a form which can be read by operator>> and from_chars().
+///@ingroup gLinAlg
+template<class Precision> char* to_chars(char* first, char* last, const SO3<Precision>& rot, char separator=' ')
+{
+	return to_chars(first, last, rot.get_matrix(), separator);
+}
+
+///Format an SE3 as text, in a form which can be read by operator>> and from_chars().
+///@ingroup gLinAlg
+template<class Precision> char* to_chars(char* first, char* last, const SE3<Precision>& pose, char separator=' ')
+{
+	for(int r=0; r < 3 && first; r++)
+	{
+		first = to_chars(first, last, pose.get_rotation().get_matrix()[r], separator);
+		first = Internal::format_char(first, last, separator);
+		if(first)
+			first = Internal::format_number(first, last, pose.get_translation()[r]);
+		first = Internal::format_char(first, last, '\n');
+	}
+	return first;
+}
+
+namespace Internal
+{
+	///@internal
+	///Format an object with to_chars, growing the string until it fits.
+	///@ingroup gInternal
+	template<class T> std::string chars_to_string(const T& t, char separator)
+	{
+		std::string s(64, ' ');
+		for(;;)
+		{
+			char* end = to_chars(&s[0], &s[0] + s.size(), t, separator);
+			if(end)
+			{
+				s.resize(end - &s[0]);
+				return s;
+			}
+			s.resize(s.size() * 2);
+		}
+	}
+}
+
+///Format a vector as a string. See to_chars().
+///@ingroup gLinAlg
+template<int Size, class Precision, class Base> std::string to_string(const Vector<Size, Precision, Base>& v, char separator=' ')
+{
+	return Internal::chars_to_string(v, separator);
+}
+
+///Format a matrix as a string. See to_chars().
+///@ingroup gLinAlg
+template<int Rows, int Cols, class Precision, class Layout> std::string to_string(const Matrix<Rows, Cols, Precision, Layout>& m, char separator=' ')
+{
+	return Internal::chars_to_string(m, separator);
+}
+
+///Format an SO3 as a string. See to_chars().
+///@ingroup gLinAlg
+template<class Precision> std::string to_string(const SO3<Precision>& rot, char separator=' ')
+{
+	return Internal::chars_to_string(rot, separator);
+}
+
+///Format an SE3 as a string. See to_chars().
+///@ingroup gLinAlg
+template<class Precision> std::string to_string(const SE3<Precision>& pose, char separator=' ')
+{
+	return Internal::chars_to_string(pose, separator);
+}
+
+///Read rows of numbers from a stream of text, one row per line. Numbers are
+///separated by whitespace or commas, so whitespace separated and CSV files
+///can both be read. Blank lines and lines starting with \c # are skipped.
+///The stream is read a line at a time, and the numbers are parsed without
+///using iostreams.
+///@code
+///	std::ifstream f("trajectory.txt");
+///	RowReader<> reader(f);
+///	Vector<8> pose;                  //time, x, y, z, qx, qy, qz, qw
+///	while(reader.read(pose))
+///		...
+///@endcode
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision> class RowReader
+{
+	public:
+		///Read from the given stream.
+		RowReader(std::istream& i)
+		:is(i)
+		{}
+
+		///Read the next row in to a vector, which is resized to fit if it is
+		///Resizable (or Bounded). Otherwise the number of elements in the row
+		///must match the size of the vector.
+		///@return false at the end of the stream, or on an error. On an error,
+		///        failbit is set on the stream.
+		template<int Size, class Base> bool read(Vector<Size, Precision, Base>& v)
+		{
+			if(!next_row())
+				return false;
+
+			v.try_destructive_resize((int)row.size());
+			if(v.size() != (int)row.size())
+			{
+				is.setstate(std::ios::failbit);
+				return false;
+			}
+
+			for(int i=0; i < v.size(); i++)
+				v[i] = row[i];
+			return true;
+		}
+
+		///Read all of the remaining rows in to a matrix. All rows must be
+		///the same length.
+		///@return The matrix, which is empty on error or if there are no rows.
+		///        On an error, failbit is set on the stream.
+		Matrix<Dynamic, Dynamic, Precision> read_matrix()
+		{
+			std::vector<Precision> data;
+			int cols=0;
+			int rows=0;
+
+			while(next_row())
+			{
+				if(rows != 0 && (int)row.size() != cols)
+				{
+					is.setstate(std::ios::failbit);
+					rows = cols = 0;
+					break;
+				}
+
+				cols = (int)row.size();
+				data.insert(data.end(), row.begin(), row.end());
+				rows++;
+			}
+
+			Matrix<Dynamic, Dynamic, Precision> m(rows, cols);
+			for(int r=0; r < rows; r++)
+				for(int c=0; c < cols; c++)
+					m(r,c) = data[r*cols + c];
+			return m;
+		}
+
+	private:
+		///Parse the next nonempty line in to row.
+		bool next_row()
+		{
+			while(std::getline(is, line))
+			{
+				const char* p = Internal::skip_number_separators(line.data(), line.data() + line.size());
+				const char* last = line.data() + line.size();
+				if(p == last || *p == '#')
+					continue;
+
+				row.clear();
+				while(p != last)
+				{
+					Precision x;
+					p = Internal::parse_number(p, last, x);
+					if(p == 0)
+					{
+						is.setstate(std::ios::failbit);
+						return false;
+					}
+					row.push_back(x);
+					p = Internal::skip_number_separators(p, last);
+				}
+				return true;
+			}
+			return false;
+		}
+
+		std::istream& is;
+		std::string line;
+		std::vector<Precision> row;
+};
+
+///Read a whitespace separated or CSV matrix from a stream. See RowReader.
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision> Matrix<Dynamic, Dynamic, Precision> read_matrix(std::istream& is)
+{
+	return RowReader<Precision>(is).read_matrix();
+}
+
+}
+
+#endif
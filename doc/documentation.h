@@ -88,8 +88,13 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
  - \ref sScalars
  - \ref ssExamples
  - \ref sSTL
+ - \ref sIterators
  - \ref sResize
  - \ref sDebug
+ - \ref sBenchmark
+ - \ref sCompileTime
+ - \ref sInstrument
+ - \ref sNoHeap
  - \ref sSlices
  - \ref sFuncSlices
  - \ref sPrecision
@@ -358,7 +363,16 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 		Matrix.diagonal_slice();                               //Get the leading diagonal as a vector.
 		Vector.as_diagonal();                                  //Represent a Vector as a DiagonalMatrix
 		@endcode
-		
+
+		A DiagonalMatrix can be added to or subtracted from a Matrix without
+		being converted to a dense matrix, so adding a damping term costs only
+		the result:
+		@code
+		Matrix<> A2 = A + lambda * A.diagonal_slice().as_diagonal();
+		A += v.as_diagonal();                                  //O(N)
+		DiagonalMatrix<3> Di = inverse(v.as_diagonal());
+		@endcode
+
 		Like other features of TooN, mixed static/dynamic slicing is allowed.
 		For example:
 
@@ -413,6 +427,19 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 
 		They can also be initialized with data from another source. See also \ref  sWrap.
 
+		Small statically sized vectors and (row major) matrices made with
+		makeVector or Data can be constants known at compile time, as can
+		the generators of SO2, SE2, SO3 and SE3:
+		@code
+			constexpr Vector<3> up = makeVector(0, 0, 1);
+			constexpr Matrix<2> flip = Data(0, 1, 1, 0);
+			static_assert(up[2] == 1 && flip(0, 1) == 1, "");
+			constexpr Matrix<3> Gx = SO3<>::generator(0);
+		@endcode
+		Elements can be read with <code>v[i]</code> and <code>m(r, c)</code> in
+		constant expressions. Arithmetic on vectors and matrices is still done
+		at run time.
+
 
 
 
@@ -441,8 +468,32 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 
 	\subsection sSTL How do I store Dynamic vectors in STL containers.
 
-	As C++ does not yet support move semantics, you can only safely store
-	static and resizable Vectors in STL containers.
+	Vectors and matrices can be moved. A Vector or Matrix which owns heap
+	storage (Dynamic, Resizable, or statically sized but too large for the
+	stack) is moved by taking or swapping its storage, so nothing is copied and
+	nothing is allocated. Statically sized objects on the stack and Bounded
+	objects are copied, and slices always copy the data into the object they
+	refer to. A moved-from object which owned heap storage is left empty (its
+	dynamic sizes are zero). It can be destroyed, or assigned to in any way,
+	which gives it storage of the size of the right hand side again. STL
+	containers of Dynamic Vectors are safe as long as elements are never copy
+	assigned with mismatched sizes.
+
+	\subsection sIterators Can I use STL algorithms on vectors?
+
+	Yes. Every Vector, including slices, has random access iterators
+	(<code>begin()</code>, <code>end()</code>, <code>rbegin()</code>,
+	etc.). Vectors with unit stride are iterated with plain pointers, so the
+	standard algorithms see contiguous memory. Matrix rows and columns are
+	vector slices, so they can be iterated too:
+	@code
+		Vector<> v(100);
+		std::sort(v.begin(), v.end());
+		double sum = std::accumulate(M.T()[2].begin(), M.T()[2].end(), 0.0); //Column 2
+		for(double& x: M[0])                                                  //Row 0
+			x = 0;
+		double dot = std::transform_reduce(std::execution::par_unseq, a.begin(), a.end(), b.begin(), 0.0);
+	@endcode
 
 	\subsection sResize How do I resize a dynamic vector/matrix?
 
@@ -531,6 +582,143 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 	  generator is automatically seeded with a granularity of 1 second. Your
 	  code will not compile if you have a Vector or Matrix of a non-POD type.
 
+	\subsection sBenchmark How do I measure the speed of TooN?
+
+	The benchmark suite in <code>benchmark/</code> times matrix products,
+	the decompositions, WLS, SE3 and the optimizers. Build and run it with:
+	@code
+	make bench
+	@endcode
+	Each benchmark is calibrated, warmed up and then sampled repeatedly. The
+	median and 99th percentile are reported in nanoseconds and in reference
+	cycles (which do not depend on the current CPU frequency). The results are
+	also written as JSON to <code>benchmark/results.json</code> so that they
+	can be compared between releases. The benchmark program accepts
+	<code>--filter</code>, <code>--samples</code>, <code>--warmup</code>,
+	<code>--min-time</code> and <code>--json</code> options.
+
+	The programs in <code>regressions/</code> can also be used as a
+	performance regression test:
+	@code
+	make perftest
+	@endcode
+	Each regression program is built without debugging checks and timed
+	with the benchmark harness. The fastest run is compared against
+	<code>regressions/perf_baseline.txt</code> and the test fails if it is
+	more than <code>PERF_TOLERANCE</code> (by default 0.25, i.e. 25%) slower.
+	Timings depend on the machine, so regenerate the baseline with
+	<code>make perfbaseline</code> on the machine used for testing.
+
+	\subsection sCompileTime How do I reduce compile time?
+
+	TooN is header only, so every translation unit parses it. To parse it
+	once, build a precompiled header with the same flags as the project:
+	@code
+	make pch CXXFLAGS="-O3 -DTOON_NDEBUG"
+	@endcode
+	This creates <code>TooN.h.gch</code> next to <code>TooN.h</code>, which
+	GCC uses in place of the header when <code>TooN/TooN.h</code> is
+	the first file included. <code>make compiletime</code> measures the time
+	taken to compile a typical translation unit with and without a
+	precompiled header.
+
+	The common decompositions and transformations (e.g. Cholesky<6>,
+	Cholesky<>, SVD<>, WLS<6> and SE3<>, see <code>instances.h</code>) can
+	be compiled once instead of in every translation unit which uses them:
+	@code
+	make libtoon_instances CXXFLAGS="-O3 -DTOON_NDEBUG"
+	@endcode
+	Include <code>TooN/instances.h</code> before using them, and link
+	against <code>libtoon_instances.a</code>. Much of TooN is inline and so
+	is still compiled where it is used, but this reduces both compile time
+	and object size, particularly in unoptimized builds.
+
+	\subsection sInstrument How do I find out where time and memory go?
+
+	Define \c TOON_INSTRUMENT before including any TooN headers (and in every
+	translation unit) to enable per-thread performance counters. Without the
+	macro, the instrumentation compiles to nothing. The counters record:
+	- heap allocations made for Vector and Matrix data, and their size,
+	- copy constructions of Vectors and Matrices and the number of bytes copied,
+	- calls and approximate floating point operations for each operator
+	  (e.g. <code>"matrix * matrix"</code>) and decomposition
+	  (e.g. <code>"Cholesky"</code>),
+	- time spent in each decomposition's <code>compute()</code>.
+
+	@code
+		#define TOON_INSTRUMENT
+		#include <TooN/TooN.h>
+
+		TooN::Instrument::reset();
+		track_one_frame();
+		TooN::Instrument::print(std::cerr);
+
+		if(TooN::Instrument::report().allocations != 0)
+			std::cerr << "The inner loop allocates!\n";
+	@endcode
+
+	The counters are kept per thread: TooN::Instrument::report() returns the
+	counters for the calling thread. Instrumentation changes the timings
+	somewhat, so use \ref sBenchmark "the benchmarks" for measuring speed.
+
+	\subsection sNoHeap How do I make sure TooN never uses the heap?
+
+	Statically sized Vectors and Matrices store their data in place, unless
+	they are larger than TooN::Internal::max_bytes_on_stack (1000 bytes by
+	default; set it with <code>./configure --with-max_bytes_on_stack=N</code>
+	or by defining \c TOON_MAX_BYTES_ON_STACK). Dynamic and
+	Resizable ones always use the heap, including any temporaries created while
+	evaluating expressions. 
+
+	The placement can be chosen for individual objects with the TooN::Stack
+	and TooN::Heap storage policies. The results of operators on Stack objects
+	are also on the stack:
+	@code
+		Matrix<15, 15, double, Stack> P, F, Q; //1800 bytes, on the stack
+		P = F * P * F.T() + Q;                 //No heap allocation
+	@endcode
+	Defining \c TOON_NO_HEAP_SPILL makes it a compile error for a statically
+	sized object to be moved to the heap because of its size, unless the
+	Heap policy is used.
+
+	For real-time code there are two ways of
+	ensuring that TooN does not allocate memory:
+	- Defining \c TOON_NO_HEAP causes a compile error in any code which
+	  would need to allocate memory for a Vector or Matrix.
+	- Creating a TooN::NoAllocGuard makes any allocation by TooN in the
+	  current thread a fatal error for the lifetime of the guard. The check
+	  is disabled by \c TOON_NDEBUG or \c NDEBUG, or individually by
+	  \c TOON_NDEBUG_HEAP.
+
+	For sizes which are only known at run time, but have a known upper bound,
+	use TooN::Bounded storage. The data is stored in place, and the size can
+	be changed up to the capacity:
+	@code
+		Vector<Dynamic, double, Bounded<12> > v(n); //Any n up to 12
+		v.resize(n+1);
+		v = x.slice(0, 5);                          //Resizes v
+	@endcode
+
+	Matrices may be Bounded too, with separate capacities for the rows and 
+	columns. Bounded matrices are row major and are not resizable.
+	The results of operators inherit the capacity of their
+	arguments, so expressions which only involve Bounded or static objects
+	do not use the heap:
+	@code
+		Matrix<Dynamic, Dynamic, double, Bounded<6, 12> > J(m, n);
+		Vector<Dynamic, double, Bounded<6> > r(m);
+		...
+		Vector<Dynamic, double, Bounded<12> > g = J.T() * r;
+	@endcode
+	Slices of Bounded objects (other than the transpose) do not carry the 
+	capacity, so temporaries made from them use the heap. 
+	TooN::Cholesky, TooN::LU and TooN::SymEigen take the layout of their
+	internal storage as the last template parameter:
+	@code
+		Cholesky<Dynamic, double, Bounded<12> > chol(J.T() * J);
+		Vector<Dynamic, double, Bounded<12> > x = chol.backsub(g);
+	@endcode
+
 	\subsection sSlices What are slices?
 
 	Slices are references to data belonging to another vector or matrix. Modifying
@@ -552,6 +740,14 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 		m[0][0]=6;
 	@endcode
 
+	A slice can have a static size at a position only known at run time. The
+	size stays part of the type, so operations on it are unrolled:
+	@code
+		Matrix<> C(60, 60);
+		C.slice<6,6>(i, j) += J1.T() * J2;  //Same as C.slice<Dynamic,Dynamic,6,6>(i, j, 6, 6)
+		v.slice<6>(i) += J1.T() * e;
+	@endcode
+
 	Slices are usually strange types. See \ref sFunctionVector
 
 	See also \sFuncSlices
@@ -657,6 +853,75 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 
 	If all you want to do is solve a single Ax=b then you may want gaussian_elimination()
 
+	\subsection sStructured What about block diagonal and banded matrices?
+
+	TooN::BlockDiagonalMatrix (in TooN/block_diagonal.h) stores only the
+	diagonal blocks, and TooN::BandedMatrix (in TooN/banded.h) stores only the
+	band. Both can be multiplied by vectors, and both accumulate normal
+	equations with add_sparse_JtWJ(), which takes the same arguments as
+	WLS::add_sparse_mJ_rows() without the measurement. They are solved with
+	TooN::BlockDiagonalCholesky and TooN::BandedCholesky, which work in time
+	linear in the size of the matrix:
+	@code
+		BandedMatrix<2> A(knots);
+		A = Identity;
+		for(int i=0; i < knots-2; i++)
+			A.add_sparse_JtWJ(second_difference, i, smoothing);
+		Vector<> x = BandedCholesky<2>(A).backsub(b);
+	@endcode
+
+	\subsection sSparse What about general sparse matrices?
+
+	TooN::SparseMatrix (in TooN/sparse.h) stores a matrix in compressed sparse
+	row form. It is built from a list of TooN::SparseEntry, and supports
+	products with vectors and JtJ(). Symmetric sparse systems are solved with
+	TooN::SparseCholesky, which computes a minimum degree ordering and the
+	structure of the factor once with analyze(), and can then factorize() any
+	number of matrices with the same pattern:
+	@code
+		SparseMatrix<> J(measurements, parameters, entries);
+		SparseCholesky<> chol;
+		chol.analyze(JtJ(J));
+		chol.factorize(JtJ(J));
+		Vector<> dx = chol.backsub(e * J);
+	@endcode
+
+	\subsection sTriangular How do I multiply by or solve with a triangular factor?
+
+	Make a triangular view of the matrix holding the factor. The view refers
+	to the original storage and only reads the elements in the triangle, so
+	products and solves take half the work of the dense versions:
+	@code
+		Matrix<6> L = chol.get_L();
+		Vector<6> w = solve(lower_triangular(L), v);  // L^-1 v
+		Vector<6> u = lower_triangular(L).T() * w;    // L^T w
+
+		Vector<4> y = upper_triangular(qr.get_R()) * x;
+	@endcode
+	unit_upper_triangular() and unit_lower_triangular() treat the diagonal as
+	all ones, which is the form of the L stored by LU::get_lu(). See
+	TooN::TriangularMatrix.
+
+	\subsection sSymmetric How do I store a symmetric matrix?
+
+	Use TooN::SymmetricMatrix. It stores only the upper triangle, packed
+	row by row, so an \f$N\times N\f$ matrix occupies \f$N(N+1)/2\f$
+	elements. Normal equations can be accumulated directly without forming
+	the dense product:
+	@code
+		SymmetricMatrix<6> JTJ = Zeros;
+		JTJ.add_JtJ(J);              // JTJ += J^T J
+		JTJ.add_JtWJ(J, W);          // W is a DiagonalMatrix or SymmetricMatrix
+		JTJ.add_outer(g, w);         // JTJ += w g g^T
+
+		Vector<6> y = JTJ * x;
+		Cholesky<6> chol(JTJ);
+		SymEigen<6> eig(JTJ);
+	@endcode
+	Elements are accessed with <code>m(r,c)</code>, which returns the same
+	element as <code>m(c,r)</code>, and <code>dense()</code> returns an
+	ordinary Matrix.
+
 	\subsection sOtherStuff What other stuff is there:
 	
 	Look at the @link modules modules @endlink.
@@ -665,6 +930,18 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 
 	See @link gLinAlg here @endlink.
 
+	The matrix exponential TooN::exp() uses a Pade approximant with scaling
+	and squaring, so its cost depends only on the norm of the matrix. When
+	many exponentials of the same size are needed, TooN::MatrixExponential
+	keeps its workspace between calls:
+	@code
+		MatrixExponential<> e(n);
+		for(...)
+			x = e.compute(A) * x;
+	@endcode
+	TooN::log() and TooN::sqrt() use a bounded number of square roots and
+	Denman-Beavers steps, and evaluate the logarithm with a Pade approximant.
+
 	\subsection sAutomaticDifferentiation Does TooN support automatic differentiation?
 	
 	TooN has buildin support for <a href="http://www.fadbad.com/fadbad.html">FADBAD++</a>.
@@ -756,8 +1033,104 @@ This section is arranged as a FAQ. Most answers include code fragments. Assume
 	Matrix<Dynamic, 3, double, Reference::RowMajor> m4(d, 2, 3); // note two size arguments are required for semi-dynamic matrices
 	@endcode
 
+	Data which is not contiguous, such as a window in to an image with padded
+	rows or interleaved fields, can be wrapped by giving the strides
+	explicitly. The result is a slice:
+	@code
+	float image[480*704];   //Rows are padded to 704 elements
+	wrapMatrix(image + 704*100 + 200, 32, 32, 704, 1);  //32x32 window, row stride 704, column stride 1
+
+	float points[4*N];      //x, y, z, intensity
+	wrapMatrix<Dynamic, 3>(points, N, 3, 4, 1);          //Nx3 matrix of the points
+	wrapVector(points + 3, N, 4);                        //The intensities
+	@endcode
+
 	See also wrapVector() and wrapMatrix().
 
+	\subsection sSplines How do I interpolate poses and trajectories?
+
+	The header \c TooN/spline.h provides interpolate(), which moves along
+	the geodesic between two SO3, SE3 or SIM3 transformations, and
+	CumulativeSpline, a uniform cumulative cubic B-spline through a sequence
+	of control poses. The spline gives the pose, body frame velocity and
+	acceleration at any time, evaluates many times in one call (for example
+	one per image row of a rolling shutter camera), and gives the Jacobian of
+	the pose with respect to the four control poses it depends on:
+	@code
+	CumulativeSpline<SE3<> > trajectory(t0, dt);
+	for(size_t i=0; i < keyframes.size(); i++)
+		trajectory.push_back(keyframes[i]);
+
+	SE3<> pose;
+	Vector<6> velocity, acceleration;
+	trajectory.evaluate(t, pose, velocity, acceleration);
+	Matrix<6, 24> J = trajectory.pose_jacobian(t);  //Poses segment(t) to segment(t)+3
+	@endcode
+
+	\subsection sAveraging How do I average rotations and poses?
+
+	mean() computes the (optionally weighted) mean of a range of SO3
+	rotations or SE3 transformations. It starts from the closed form chordal
+	mean and refines it with a few Gauss-Newton steps, so no initial guess
+	is needed. It is in \c TooN/rotation_averaging.h, so that \c TooN/so3.h
+	and \c TooN/se3.h do not need the SVD:
+	@code
+	#include <TooN/rotation_averaging.h>
+
+	std::vector<SE3<> > measurements;
+	std::vector<double> weights;
+	SE3<> camera_to_rig = mean(measurements.begin(), measurements.end(), weights.begin());
+	@endcode
+	To find the absolute rotations of the nodes of a pose graph from many
+	relative rotations, chordal_rotation_averaging() in
+	\c TooN/rotation_averaging.h solves the chordal relaxation as a sparse
+	linear problem. This gives a good initialization for a full bundle
+	adjustment.
+
+	\subsection sTextIO How do I read and write large amounts of text quickly?
+
+	The stream operators go through iostreams one element at a time, which
+	is slow for large files. The header \c TooN/charconv.h provides
+	from_chars() and to_chars() for vectors, matrices, SO3 and SE3, which work
+	directly on character buffers and do not depend on the locale. Output is
+	the shortest text which reads back to exactly the same value, and is in
+	the same format as the stream operators. \c std::from_chars and \c
+	std::to_chars are used where the standard library supports them for
+	floating point, and the C library is used otherwise. RowReader and
+	read_matrix() read whitespace separated or CSV files a line at a time:
+	@code
+	std::ifstream f("poses.csv");
+	Matrix<> poses = read_matrix(f);
+
+	std::string s = to_string(pose);
+	from_chars(s.data(), s.data() + s.size(), pose);
+	@endcode
+
+	\subsection sBinaryIO How do I save and load large vectors and matrices quickly?
+
+	The stream operators read and write text, which is slow for large
+	objects. The header \c TooN/binary_io.h provides save() and load(), which
+	use a compact binary format: a small versioned header recording the size,
+	precision and order of the elements (see BinaryHeader), followed by the
+	raw data.
+	@code
+	std::ofstream out("basis.toon", std::ios::binary);
+	save(out, basis);
+
+	std::ifstream in("basis.toon", std::ios::binary);
+	Matrix<> m = load_matrix(in);   //Any size
+	load(in, v);                    //The size must match, unless v is Resizable
+	@endcode
+	Errors, such as a mismatch in size or precision, set \c failbit on the
+	stream.
+
+	On POSIX systems, a file can also be mapped in to memory, giving a
+	Reference matrix which is never copied or read up front:
+	@code
+	MappedMatrix<> basis("basis.toon");
+	Vector<> c = basis.matrix() * x;
+	@endcode
+
 	\subsection sGenericCode How do I write generic code?
 	
 	The constructors for TooN objects are very permissive in that they 
@@ -868,8 +1241,11 @@ that problem by having a cutoff at which statically sized vectors are allocated
 on the heap. This is completely transparent to the programmer, the objects'
 behaviour is unchanged and you still get the type safety offered by statically
 sized vectors and matrices. The cutoff size at which the library changes the
-representation is defined in <code>TooN.h</code> as the <code>const int
-TooN::Internal::max_bytes_on_stack=1000;</code>.
+representation is defined in <code>TooN.h</code> as 
+TooN::Internal::max_bytes_on_stack, which is 1000 bytes unless changed with 
+<code>./configure --with-max_bytes_on_stack=N</code> or by defining
+\c TOON_MAX_BYTES_ON_STACK. The TooN::Stack and TooN::Heap storage policies
+override the cutoff for individual objects (see \ref sNoHeap).
 
 When you apply the subscript operator to a <code>Matrix<3,3></code> and the
 function simply returns a vector which points to the the apropriate hunk of memory as a reference
@@ -48,6 +48,7 @@ namespace TooN
 template<int R, int C, class Precision, class Base> void gauss_jordan(Matrix<R, C, Precision, Base>& m)
 {
 	using std::swap;
+	TOON_INSTRUMENT_TIMED_OPERATION("gauss_jordan", 2.0*m.num_rows()*m.num_rows()*m.num_cols());
 
 	//Loop over columns to reduce.
 	for(int col=0; col < m.num_rows(); col++)
@@ -45,6 +45,7 @@ namespace TooN {
 		using std::abs;
 
 		int size=b.size();
+		TOON_INSTRUMENT_TIMED_OPERATION("gaussian_elimination", 2.0*size*size*size/3 + 2.0*size*size);
 
 		for (int i=0; i<size; ++i) {
 			int argmax = i;
@@ -98,17 +99,20 @@ namespace TooN {
 	};
 
 	///@ingroup gEquations
-	///Return the solution for \f$Ax = b\f$, given \f$A\f$ and \f$b\f$
+	///Solve \f$AX = B\f$ in place. \f$A\f$ is destroyed and \f$B\f$ is
+	///overwritten with the solution \f$X\f$. No memory is allocated, so this
+	///can be used on workspaces which are reused between solves.
 	///@param A \f$A\f$
-	///@param b \f$b\f$
-    template<int R1, int C1, int R2, int C2, typename Precision>
-	inline Matrix<Internal::Size3<R1, C1, R2>::s, C2, Precision> gaussian_elimination (Matrix<R1,C1,Precision> A, Matrix<R2, C2, Precision> b) {
+	///@param b \f$B\f$
+	template<int R1, int C1, typename B1, int R2, int C2, typename B2, typename Precision>
+	inline void gaussian_elimination_in_place(Matrix<R1,C1,Precision,B1>& A, Matrix<R2,C2,Precision,B2>& b) {
 		using std::swap;
 		using std::abs;
 		SizeMismatch<R1, C1>::test(A.num_rows(), A.num_cols());
 		SizeMismatch<R1, R2>::test(A.num_rows(), b.num_rows());
 
 		int size=A.num_rows();
+		TOON_INSTRUMENT_TIMED_OPERATION("gaussian_elimination", 2.0*size*size*size/3 + 2.0*size*size*b.num_cols());
 
 		for (int i=0; i<size; ++i) {
 			int argmax = i;
@@ -145,16 +149,21 @@ namespace TooN {
 			}
 		}
 		
-		Matrix<Internal::Size3<R1, C1, R2>::s,C2,Precision> x(b.num_rows(), b.num_cols());
-		for (int i=size-1; i>=0; --i) {
+		//Back substitution: rows below i of b already hold the solution.
+		for (int i=size-1; i>=0; --i)
 			for(int k=0; k <b.num_cols(); k++)
-			{
-				x[i][k] = b[i][k];
 				for (int j=i+1; j<size; ++j)
-					x[i][k] -= A[i][j] * x[j][k];
-			}
-		}
-		return x;
+					b[i][k] -= A[i][j] * b[j][k];
+	}
+
+	///@ingroup gEquations
+	///Return the solution for \f$Ax = b\f$, given \f$A\f$ and \f$b\f$
+	///@param A \f$A\f$
+	///@param b \f$b\f$
+    template<int R1, int C1, int R2, int C2, typename Precision>
+	inline Matrix<Internal::Size3<R1, C1, R2>::s, C2, Precision> gaussian_elimination (Matrix<R1,C1,Precision> A, Matrix<R2, C2, Precision> b) {
+		gaussian_elimination_in_place(A, b);
+		return b;
     }
 }
 #endif
@@ -283,58 +283,237 @@ namespace TooN {
 
 	namespace Internal {
 		///@internal
-		///@brief Exponentiate a matrix using a the Taylor series
-		///This will not work if the norm of the matrix is too large.
-		template <int R, int C, typename P, typename B>
-		inline Matrix<R, C, P> exp_taylor( const Matrix<R,C,P,B> & m ){
-			TooN::SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
-			Matrix<R,C,P> result = TooN::Zeros(m.num_rows(), m.num_cols());
-			Matrix<R,C,P> f = TooN::Identity(m.num_rows());
-			P k = 1;
-			while(norm_inf((result+f)-result) > 0){
-				result += f;
-				f = (m * f) / k;
-				k += 1;
+		///@brief The [8/8] Pade approximant of log(I + X) in partial fractions,
+		///\f$ \sum_j w_j X (I + x_j X)^{-1} \f$, where \f$x_j\f$ and \f$w_j\f$ are
+		///the nodes and weights of the 8 point Gauss-Legendre rule on [0, 1].
+		///See Higham, 'Evaluating Pade approximants of the matrix logarithm',
+		///SIAM J. Matrix Anal. Appl., 2001.
+		///@ingroup gInternal
+		struct PadeLog
+		{
+			static const int order = 8;
+
+			///The largest 1-norm of X for which the approximant is accurate
+			///to double precision.
+			static double theta() { return 0.32; }
+
+			static double node(int i)
+			{
+				static const double x[order] = {9.8014492824876809e-01, 8.9833323870681336e-01, 7.6276620495816450e-01, 5.9171732124782495e-01, 4.0828267875217511e-01, 2.3723379504183550e-01, 1.0166676129318664e-01, 1.9855071751231884e-02};
+				return x[i];
 			}
-			return result;
-		}
+
+			static double weight(int i)
+			{
+				static const double w[order] = {5.0614268145188129e-02, 1.1119051722668724e-01, 1.5685332293894363e-01, 1.8134189168918100e-01, 1.8134189168918100e-01, 1.5685332293894363e-01, 1.1119051722668724e-01, 5.0614268145188129e-02};
+				return w[i];
+			}
+		};
 
 		///@internal
-		///@brief Logarithm of a matrix using a the Taylor series
-		///This will not work if the norm of the matrix is too large.
+		///The 1-norm of m - I.
+		///@ingroup gInternal
 		template <int R, int C, typename P, typename B>
-		inline Matrix<R, C, P> log_taylor( const Matrix<R,C,P,B> & m ){
-			TooN::SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
-			Matrix<R,C,P> X = m - TooN::Identity * 1.0;
-			Matrix<R,C,P> F = X;
-			Matrix<R,C,P> sum = TooN::Zeros(m.num_rows(), m.num_cols());
-			P k = 1;
-			while(norm_inf((sum+F/k)-sum) > 0){
-				sum += F/k;
-				F = -F*X;
-				k += 1;
+		P norm_1_minus_identity(const Matrix<R,C,P,B>& m){
+			using std::abs;
+			using std::max;
+			P n = 0;
+			for(int c = 0; c < m.num_cols(); ++c){
+				P s = 0;
+				for(int r = 0; r < m.num_rows(); ++r)
+					s += abs(r == c ? m(r,c) - 1 : m(r,c));
+				n = max(n,s);
 			}
-			return sum;
+			return n;
 		}
 
 	};
 	
-	/// computes the matrix exponential of a matrix m by 
-	/// scaling m by 1/(powers of 2), using Taylor series and 
-	/// squaring again.
+	namespace Internal {
+		///@internal
+		///@brief Coefficients and norm bounds for the Pade approximants of the
+		///matrix exponential, from N. J. Higham, 'The scaling and squaring method
+		///for the matrix exponential revisited', SIAM J. Matrix Anal. Appl., 2005.
+		///@ingroup gInternal
+		struct PadeExp
+		{
+			///The largest 1-norm for which the approximant of each order
+			///(3, 5, 7, 9 and 13) is accurate to double precision.
+			static double theta(int i)
+			{
+				static const double t[5] = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1, 2.097847961257068e0, 5.371920351148152e0};
+				return t[i];
+			}
+
+			///The coefficients of the approximant of each order.
+			static const double* coefficients(int i)
+			{
+				static const double b3[] = {120., 60., 12., 1.};
+				static const double b5[] = {30240., 15120., 3360., 420., 30., 1.};
+				static const double b7[] = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+				static const double b9[] = {17643225600., 8821612800., 2075673600., 302702400., 30270240., 2162160., 110880., 3960., 90., 1.};
+				static const double b13[] = {64764752532480000., 32382376266240000., 7771770303897600., 1187353796428800., 129060195264000., 10559470521600., 670442572800., 33522128640., 1323241920., 40840800., 960960., 16380., 182., 1.};
+				static const double* b[5] = {b3, b5, b7, b9, b13};
+				return b[i];
+			}
+		};
+	}
+
+	/**
+	Computes the matrix exponential by scaling and squaring with a Pade
+	approximant, following Higham (2005). The order of the approximant
+	(3, 5, 7, 9 or 13) and the number of squarings are chosen from the
+	1-norm of the matrix, so the cost is fixed by the norm: at most 6
+	matrix products and one linear solve, plus one product per squaring.
+
+	The workspace is kept between calls, so repeatedly exponentiating
+	matrices of the same size does not allocate memory. Statically sized
+	workspaces are stored on the stack.
+	@code
+	MatrixExponential<3> e;
+	for(...)
+		H = e.compute(A) * H;
+	@endcode
+	@ingroup gLinAlg
+	**/
+	template<int Size=Dynamic, typename Precision=DefaultPrecision>
+	class MatrixExponential {
+	public:
+		/// Create the workspace. The size is only needed for dynamic matrices.
+		MatrixExponential(int size=Size)
+		:A(size, size), A2(size, size), A4(size, size), A6(size, size), A8(size, size), U(size, size), V(size, size), W(size, size), order(0), squarings(0)
+		{}
+
+		/// Compute the exponential of m.
+		/// @return the exponential, which is valid until the next call
+		template<int R, int C, typename P, typename B>
+		const Matrix<Size, Size, Precision>& compute(const Matrix<R, C, P, B>& m)
+		{
+			using std::ceil;
+			using std::ldexp;
+			using std::log2;
+			using std::max;
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(A.num_rows(), m.num_rows());
+
+			const Precision norm = norm_1(m);
+			int index = 0;
+			while(index < 4 && norm > Internal::PadeExp::theta(index))
+				index++;
+			squarings = 0;
+			if(index == 4 && norm > Internal::PadeExp::theta(4))
+				squarings = max(0, (int)ceil(log2(norm / Internal::PadeExp::theta(4))));
+			order = index == 4 ? 13 : 2 * index + 3;
+
+			const Precision scale = ldexp(1.0, -squarings);
+			for(int r=0; r < n(); r++)
+				for(int c=0; c < n(); c++)
+					A(r,c) = m(r,c) * scale;
+
+			const double* b = Internal::PadeExp::coefficients(index);
+			multiply(A2, A, A);
+			if(order >= 5)
+				multiply(A4, A2, A2);
+			if(order >= 7)
+				multiply(A6, A4, A2);
+
+			if(order <= 9) {
+				if(order == 9)
+					multiply(A8, A4, A4);
+				//U = A (b1 + b3 A^2 + ...), V = b0 + b2 A^2 + ...
+				combine(W, b[1], b + 3, order / 2);
+				combine(V, b[0], b + 2, order / 2);
+				multiply(U, A, W);
+			} else {
+				//Higham's evaluation of the [13/13] approximant in 6 products
+				combine_high(W, b + 9);
+				multiply(U, A6, W);
+				add(U, b[1], b + 3);
+				multiply(W, A, U);
+				combine_high(U, b + 8);
+				multiply(V, A6, U);
+				add(V, b[0], b + 2);
+				U = W;
+			}
+
+			//Solve (V - U) X = (V + U), with X left in V
+			for(int r=0; r < n(); r++)
+				for(int c=0; c < n(); c++) {
+					W(r,c) = V(r,c) - U(r,c);
+					V(r,c) += U(r,c);
+				}
+			gaussian_elimination_in_place(W, V);
+
+			for(int i=0; i < squarings; i++) {
+				multiply(U, V, V);
+				V = U;
+			}
+			return V;
+		}
+
+		/// The exponential computed by the last call to compute().
+		const Matrix<Size, Size, Precision>& get_exp() const { return V; }
+
+		/// The order of the Pade approximant used by the last call to compute().
+		int get_order() const { return order; }
+
+		/// The number of squarings used by the last call to compute().
+		int get_squarings() const { return squarings; }
+
+	private:
+		int n() const { return A.num_rows(); }
+
+		static void multiply(Matrix<Size, Size, Precision>& out, const Matrix<Size, Size, Precision>& l, const Matrix<Size, Size, Precision>& r)
+		{
+			out = Operator<Internal::MatrixMultiply<Size, Size, Precision, RowMajor, Size, Size, Precision, RowMajor> >(l, r);
+		}
+
+		//out = b0 I + b[0] A^2 + b[2] A^4 + ... with the given number of powers of A^2
+		void combine(Matrix<Size, Size, Precision>& out, double b0, const double* b, int terms)
+		{
+			const Matrix<Size, Size, Precision>* powers[4] = {&A2, &A4, &A6, &A8};
+			for(int r=0; r < n(); r++)
+				for(int c=0; c < n(); c++) {
+					Precision sum = r == c ? b0 : 0;
+					for(int k=0; k < terms; k++)
+						sum += b[2*k] * (*powers[k])(r,c);
+					out(r,c) = sum;
+				}
+		}
+
+		//out = b[4] A^6 + b[2] A^4 + b[0] A^2
+		void combine_high(Matrix<Size, Size, Precision>& out, const double* b)
+		{
+			for(int r=0; r < n(); r++)
+				for(int c=0; c < n(); c++)
+					out(r,c) = b[4] * A6(r,c) + b[2] * A4(r,c) + b[0] * A2(r,c);
+		}
+
+		//out += b[4] A^6 + b[2] A^4 + b[0] A^2 + b0 I
+		void add(Matrix<Size, Size, Precision>& out, double b0, const double* b)
+		{
+			for(int r=0; r < n(); r++) {
+				for(int c=0; c < n(); c++)
+					out(r,c) += b[4] * A6(r,c) + b[2] * A4(r,c) + b[0] * A2(r,c);
+				out(r,r) += b0;
+			}
+		}
+
+		Matrix<Size, Size, Precision> A, A2, A4, A6, A8, U, V, W;
+		int order, squarings;
+	};
+
+	/// computes the matrix exponential of a matrix m by scaling and
+	/// squaring with a Pade approximant. See MatrixExponential, which
+	/// can be reused to avoid allocating memory on every call.
 	/// @param m input matrix, must be square
 	/// @return result matrix of the same size/type as input
 	/// @ingroup gLinAlg
 	template <int R, int C, typename P, typename B>
 	inline Matrix<R, C, P> exp( const Matrix<R,C,P,B> & m ){
-		using std::max;
 		SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
-		const P l = log2(norm_inf(m));
-		const int s = max(0,(int)ceil(l));
-		Matrix<R,C,P> result = Internal::exp_taylor(m/(1<<s));
-		for(int i = 0; i < s; ++i)
-			result = result * result;
-		return result;
+		MatrixExponential<Internal::Sizer<R, C>::size, P> e(m.num_rows());
+		return e.compute(m);
 	}
 	
 	/// computes a matrix square root of a matrix m by
@@ -342,41 +521,85 @@ namespace TooN {
 	/// as given in Chen et al. 'Approximating the logarithm of a matrix to specified accuracy', 
 	/// J. Matrix Anal Appl, 2001. This is used for the matrix
 	/// logarithm function, but is useable by on its own.
+	/// The iteration converges quadratically. It stops one step after
+	/// \f$\|M - I\|_1\f$ falls below the square root of the machine precision,
+	/// and never takes more than 32 steps.
 	/// @param m input matrix, must be square
 	/// @return a square root of m of the same size/type as input
 	/// @ingroup gLinAlg
 	template <int R, int C, typename P, typename B>
 	inline Matrix<R, C, P> sqrt( const Matrix<R,C,P,B> & m){
+		using std::sqrt;
 		SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+		const int n = m.num_rows();
 		Matrix<R,C,P> M = m;
 		Matrix<R,C,P> Y = m;
-		Matrix<R,C,P> M_inv(m.num_rows(), m.num_cols());
-		const Matrix<R,C,P> id = Identity(m.num_rows());
-		do {
-			M_inv = gaussian_elimination(M, id);
-			Y = Y * (id + M_inv) * 0.5;
-			M = 0.5 * (id + (M + M_inv) * 0.5);
-		} while(norm_inf(M - M_inv) > 0);
+		Matrix<R,C,P> M_inv(n, n), LU(n, n);
+		const P tolerance = sqrt(std::numeric_limits<P>::epsilon());
+		bool last_step = false;
+		for(int i=0; i < 32; i++) {
+			//M_inv = M^-1, without allocating
+			LU = M;
+			M_inv = Identity;
+			gaussian_elimination_in_place(LU, M_inv);
+
+			//Y = Y (I + M^-1) / 2 and M = (I + (M + M^-1) / 2) / 2
+			for(int r=0; r < n; r++)
+				for(int c=0; c < n; c++) {
+					const P d = r == c ? 0.5 : 0;
+					LU(r,c) = 0.5 * M_inv(r,c) + d;
+					M(r,c) = 0.25 * (M(r,c) + M_inv(r,c)) + d;
+				}
+			Y = Y * LU;
+
+			//The error is squared on every step, so one more step
+			//after it is small gives full precision.
+			if(last_step)
+				break;
+			last_step = Internal::norm_1_minus_identity(M) <= tolerance;
+		}
 		return Y;
 	}
 	
 	/// computes the matrix logarithm of a matrix m using the inverse scaling and 
-	/// squaring method. The overall approach is described in
+	/// squaring method, as described in
 	/// Chen et al. 'Approximating the logarithm of a matrix to specified accuracy', 
-	/// J. Matrix Anal Appl, 2001, but this implementation only uses a simple
-	/// taylor series after the repeated square root operation.
+	/// J. Matrix Anal Appl, 2001. Square roots are taken until
+	/// \f$\|A - I\|_1 \le 0.32\f$ (at most 64 of them), and then the [8/8] Pade
+	/// approximant is evaluated in partial fractions, which costs 8 linear solves.
 	/// @param m input matrix, must be square
 	/// @return the log of m of the same size/type as input
 	/// @ingroup gLinAlg
 	template <int R, int C, typename P, typename B>
 	inline Matrix<R, C, P> log( const Matrix<R,C,P,B> & m){
+		using std::ldexp;
+		SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+		const int n = m.num_rows();
 		int counter = 0;
 		Matrix<R,C,P> A = m;
-		while(norm_inf(A - Identity*1.0) > 0.5){
+		while(counter < 64 && Internal::norm_1_minus_identity(A) > Internal::PadeLog::theta()){
 			++counter;
 			A = sqrt(A);
 		}
-		return Internal::log_taylor(A) * pow(2.0, counter);
+
+		//X = A - I
+		for(int i=0; i < n; i++)
+			A(i,i) -= 1;
+
+		Matrix<R,C,P> result = Zeros(n, n);
+		Matrix<R,C,P> LU(n, n), Z(n, n);
+		for(int j=0; j < Internal::PadeLog::order; j++){
+			//Z = (I + x_j X)^-1 X
+			const P x = Internal::PadeLog::node(j);
+			for(int r=0; r < n; r++)
+				for(int c=0; c < n; c++)
+					LU(r,c) = x * A(r,c) + (r == c ? 1 : 0);
+			Z = A;
+			gaussian_elimination_in_place(LU, Z);
+			result += Internal::PadeLog::weight(j) * Z;
+		}
+		result *= ldexp(1.0, counter);
+		return result;
 	}
 	
 	/// Returns true if every element is finite
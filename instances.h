@@ -0,0 +1,95 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_INCLUDE_INSTANCES_H
+#define TOON_INCLUDE_INSTANCES_H
+
+// Explicit instantiations of commonly used decompositions and transformations.
+//
+// Including this header declares them as extern templates, so they are not
+// compiled again in every translation unit which uses them. The definitions
+// are compiled once, into libtoon_instances.a ("make libtoon_instances"),
+// which must then be linked. The library must be built with the same TooN
+// configuration and debugging flags as the code using it. Include this
+// header before any of the types below are used.
+
+#include <TooN/TooN.h>
+#include <TooN/Cholesky.h>
+#include <TooN/wls.h>
+#include <TooN/se3.h>
+
+#ifdef TOON_USE_LAPACK
+	#include <TooN/LU.h>
+	#include <TooN/SVD.h>
+	#include <TooN/SymEigen.h>
+#endif
+
+#ifdef TOON_INSTANTIATE
+	#define TOON_EXTERN
+#else
+	#define TOON_EXTERN extern
+#endif
+
+namespace TooN {
+
+TOON_EXTERN template class Cholesky<3>;
+TOON_EXTERN template class Cholesky<4>;
+TOON_EXTERN template class Cholesky<6>;
+TOON_EXTERN template class Cholesky<Dynamic>;
+TOON_EXTERN template class Cholesky<3, float>;
+TOON_EXTERN template class Cholesky<6, float>;
+TOON_EXTERN template class Cholesky<Dynamic, float>;
+
+TOON_EXTERN template class WLS<3>;
+TOON_EXTERN template class WLS<6>;
+TOON_EXTERN template class WLS<Dynamic>;
+
+TOON_EXTERN template class SO3<double>;
+TOON_EXTERN template class SE3<double>;
+TOON_EXTERN template class SO3<float>;
+TOON_EXTERN template class SE3<float>;
+
+#ifdef TOON_USE_LAPACK
+	TOON_EXTERN template class LU<3>;
+	TOON_EXTERN template class LU<6>;
+	TOON_EXTERN template class LU<Dynamic>;
+
+	TOON_EXTERN template class SVD<3>;
+	TOON_EXTERN template class SVD<6>;
+	TOON_EXTERN template class SVD<Dynamic>;
+
+	TOON_EXTERN template class SymEigen<3>;
+	TOON_EXTERN template class SymEigen<6>;
+	TOON_EXTERN template class SymEigen<Dynamic>;
+#endif
+
+}
+
+#undef TOON_EXTERN
+
+#endif
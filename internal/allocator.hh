@@ -55,6 +55,26 @@ template<class Precision> struct DefaultTypes
 };
 
 
+///@internal
+///@brief Tag for constructing an object directly from a list of its elements.
+///Owned storage for small statically sized objects can be initialised this
+///way in constant expressions.
+///@ingroup gInternal
+struct Elements{};
+
+///@internal
+///@brief Tag for filling an object from its elements after construction.
+///@ingroup gInternal
+struct EvalElements{};
+
+///@internal
+///Convert a value with the same rules as assignment.
+///@ingroup gInternal
+template<class To, class From> constexpr To implicit_cast(const From& from)
+{
+	return from;
+}
+
 template<int Size, class Precision, bool heap> class StackOrHeap;
 
 template<int Size, class Precision> class StackOrHeap<Size,Precision,0>
@@ -64,7 +84,36 @@ public:
 	{
 		debug_initialize(my_data, Size);	
 	}
+
+	template<int N, class P2>
+	constexpr StackOrHeap(Elements, const P2 (&vals)[N])
+	:StackOrHeap(vals, std::make_index_sequence<N>())
+	{
+		static_assert(N == Size, "The number of elements does not match the size");
+	}
+
+	#ifdef TOON_INSTRUMENT
+		StackOrHeap(const StackOrHeap& from)
+		{
+			TOON_INSTRUMENT_COPY(sizeof(my_data));
+			for(int i=0; i < Size; i++)
+				my_data[i] = from.my_data[i];
+		}
+
+		StackOrHeap& operator=(const StackOrHeap&) = default;
+	#endif
+
+	///Stack storage can not be moved from, so there is nothing to restore.
+	void reallocate_moved_from()
+	{}
+
 	Precision my_data[Size];
+
+private:
+	template<class P2, std::size_t... I>
+	constexpr StackOrHeap(const P2* vals, std::index_sequence<I...>)
+	:my_data{implicit_cast<Precision>(vals[I])...}
+	{}
 };
 
 template<int Size> class StackOrHeap<Size,double,0>
@@ -74,7 +123,36 @@ public:
 	{
 		debug_initialize(my_data, Size);	
 	}
+
+	template<int N, class P2>
+	constexpr StackOrHeap(Elements, const P2 (&vals)[N])
+	:StackOrHeap(vals, std::make_index_sequence<N>())
+	{
+		static_assert(N == Size, "The number of elements does not match the size");
+	}
+
+	#ifdef TOON_INSTRUMENT
+		StackOrHeap(const StackOrHeap& from)
+		{
+			TOON_INSTRUMENT_COPY(sizeof(my_data));
+			for(int i=0; i < Size; i++)
+				my_data[i] = from.my_data[i];
+		}
+
+		StackOrHeap& operator=(const StackOrHeap&) = default;
+	#endif
+
+	///Stack storage can not be moved from, so there is nothing to restore.
+	void reallocate_moved_from()
+	{}
+
 	double my_data[Size] TOON_ALIGN8 ;
+
+private:
+	template<class P2, std::size_t... I>
+	constexpr StackOrHeap(const P2* vals, std::index_sequence<I...>)
+	:my_data{implicit_cast<double>(vals[I])...}
+	{}
 };
 
 
@@ -82,7 +160,7 @@ template<int Size, class Precision> class StackOrHeap<Size, Precision, 1>
 {
 	public:
 		StackOrHeap()
-		:my_data(new Precision[Size])
+		:my_data(allocate<Precision>(Size))
 		{
 			debug_initialize(my_data, Size);	
 		}
@@ -96,21 +174,112 @@ template<int Size, class Precision> class StackOrHeap<Size, Precision, 1>
 		Precision *my_data;
 
 		StackOrHeap(const StackOrHeap& from)
-		:my_data(new Precision[Size])
+		:my_data(allocate<Precision>(Size))
 		{
+			TOON_INSTRUMENT_COPY(sizeof(Precision)*Size);
 			for(int i=0; i < Size; i++)
 				my_data[i] = from.my_data[i];
 		}
+
+		//The moved from object has no storage. It may be destroyed, or
+		//assigned to, which allocates the storage again.
+		StackOrHeap(StackOrHeap&& from) noexcept
+		:my_data(from.my_data)
+		{
+			from.my_data = 0;
+		}
+
+		void reallocate_moved_from()
+		{
+			if(my_data == 0) {
+				my_data = allocate<Precision>(Size);
+				debug_initialize(my_data, Size);
+			}
+		}
+
+		void swap(StackOrHeap& s)
+		{
+			std::swap(my_data, s.my_data);
+		}
+};
+
+///@internal
+///@brief Where the data of a statically sized object is stored. See Stack and Heap.
+///@ingroup gInternal
+enum StaticStorage
+{
+	AutoStorage,  ///< On the stack, unless it is larger than max_bytes_on_stack
+	StackStorage, ///< Always on the stack
+	HeapStorage   ///< Always on the heap
+};
+
+///@internal
+///@brief Decide whether a statically sized object is stored on the heap.
+///With TOON_NO_HEAP_SPILL defined, it is a compile error for an object to be moved
+///to the heap automatically because it is larger than max_bytes_on_stack.
+///@ingroup gInternal
+template<int Size, class Precision, int Storage> struct StoreOnHeap
+{
+	static const bool spill = sizeof(Precision)*Size > max_bytes_on_stack;
+	static const bool value = Storage == HeapStorage || (Storage == AutoStorage && spill);
+
+	#ifdef TOON_NO_HEAP_SPILL
+		static_assert(Storage != AutoStorage || !spill, "TOON_NO_HEAP_SPILL is defined, but this statically sized Vector or Matrix is larger than max_bytes_on_stack. Use the Stack or Heap storage policy, or raise TOON_MAX_BYTES_ON_STACK.");
+	#endif
 };
 
 ///@internal
 ///@brief This allocator object sets aside memory for a statically sized object. 
 ///It will
 ///put all the data on the stack if there are less then TooN::max_bytes_on_stack of
-///data, otherwise it will use new/delete.
+///data, otherwise it will use new/delete. This can be overridden with the Storage
+///parameter.
+///@ingroup gInternal
+template<int Size, class Precision, int Storage=AutoStorage> class StaticSizedAllocator: public StackOrHeap<Size, Precision, StoreOnHeap<Size, Precision, Storage>::value >
+{
+	public:
+		StaticSizedAllocator()
+		{}
+
+		template<int N, class P2>
+		constexpr StaticSizedAllocator(Elements e, const P2 (&vals)[N])
+		:StackOrHeap<Size, Precision, StoreOnHeap<Size, Precision, Storage>::value >(e, vals)
+		{}
+};
+
+///@internal
+///@brief Choose how an object is built from a list of elements.
+///Small statically sized objects which own their data, and store it in the
+///order the elements are given, are initialised directly from the elements.
+///Everything else is constructed and then filled.
+///@ingroup gInternal
+template<int Size, class Precision, bool InOrder, bool Static=(Size > 0)> struct ElementInit
+{
+	typedef EvalElements type;
+};
+
+template<bool Direct> struct ElementInitTag
+{
+	typedef EvalElements type;
+};
+
+template<> struct ElementInitTag<true>
+{
+	typedef Elements type;
+};
+
+template<int Size, class Precision> struct ElementInit<Size, Precision, true, true>
+{
+	typedef typename ElementInitTag<!StoreOnHeap<Size, Precision, AutoStorage>::value>::type type;
+};
+
+///@internal
+///@brief Whether a layout owns its data and stores elements in the order
+///they are given to makeVector() and Data(). See ElementInit.
 ///@ingroup gInternal
-template<int Size, class Precision> class StaticSizedAllocator: public StackOrHeap<Size, Precision, (sizeof(Precision)*Size>max_bytes_on_stack) >
+template<class Layout> struct InOrderStorage
 {
+	static const bool value = false;
 };
 
 
@@ -119,7 +288,7 @@ template<int Size, class Precision> class StaticSizedAllocator: public StackOrHe
 ///The class switches to heap allocation automatically for large Vectors.
 ///Naturally, the vector is not resizable.
 ///@ingroup gInternal
-template<int Size, class Precision> struct VectorAlloc : public StaticSizedAllocator<Size, Precision>, DefaultTypes<Precision> {
+template<int Size, class Precision, int Storage=AutoStorage> struct VectorAlloc : public StaticSizedAllocator<Size, Precision, Storage>, DefaultTypes<Precision> {
 	
 	///Default constructor (only for statically sized vectors)
 	VectorAlloc() { }
@@ -130,13 +299,19 @@ template<int Size, class Precision> struct VectorAlloc : public StaticSizedAlloc
 	///Construction from an Operator. See Operator::size().
 	template<class Op>
 	VectorAlloc(const Operator<Op>&) {}
+
+	///Construction directly from the elements.
+	template<int N, class P2>
+	constexpr VectorAlloc(Elements e, const P2 (&vals)[N])
+	:StaticSizedAllocator<Size, Precision, Storage>(e, vals)
+	{}
 	
 	///Return the size of the vector.
-	int size() const {
+	constexpr int size() const {
 		return Size;
 	}
 
-	using StaticSizedAllocator<Size, Precision>::my_data;
+	using StaticSizedAllocator<Size, Precision, Storage>::my_data;
 
 	Precision *get_data_ptr()
 	{
@@ -155,16 +330,21 @@ template<int Size, class Precision> struct VectorAlloc : public StaticSizedAlloc
 			return my_data;
 		};
 
-		const Precision *data() const
+		constexpr const Precision *data() const
 		{
 			return my_data;
 		};
 		
+		//The size can not change, but a moved from vector needs its storage back.
 		void try_destructive_resize(int)
-		{}
+		{
+			this->reallocate_moved_from();
+		}
 
 		template<class Op> void try_destructive_resize(const Operator<Op>&) 
-		{}
+		{
+			this->reallocate_moved_from();
+		}
 };
 
 ///@internal
@@ -173,30 +353,34 @@ template<int Size, class Precision> struct VectorAlloc : public StaticSizedAlloc
 ///@ingroup gInternal
 template<class Precision> struct VectorAlloc<Dynamic, Precision>: public DefaultTypes<Precision> {
 	Precision * my_data;
-	const int my_size;
+	int my_size;
 
 	VectorAlloc(const VectorAlloc& v)
-	:my_data(new Precision[v.my_size]), my_size(v.my_size)
+	:my_data(allocate<Precision>(v.my_size)), my_size(v.my_size)
 	{ 
+		TOON_INSTRUMENT_COPY(sizeof(Precision)*my_size);
 		for(int i=0; i < my_size; i++)
 			my_data[i] = v.my_data[i];
 	}
 
+	//The moved from vector is left empty, with no storage. Assigning
+	//to it allocates the storage again, with the size of the source.
 	VectorAlloc(VectorAlloc&& from) noexcept
 	: my_data(from.my_data), my_size(from.my_size)
 	{
 		from.my_data = 0;
+		from.my_size = 0;
 	}
 
 	VectorAlloc(int s)
-	:my_data(new Precision[s]), my_size(s)
+	:my_data(allocate<Precision>(s)), my_size(s)
 	{ 
 		debug_initialize(my_data, my_size);	
 	}
 
 	template <class Op>
 	VectorAlloc(const Operator<Op>& op) 
-	: my_data(new Precision[op.size()]), my_size(op.size()) 
+	: my_data(allocate<Precision>(op.size())), my_size(op.size()) 
 	{
 		debug_initialize(my_data, my_size);	
 	}
@@ -219,10 +403,13 @@ template<class Precision> struct VectorAlloc<Dynamic, Precision>: public Default
 		return my_data;
 	}
 
+	//A moved from vector may take the storage of any other.
 	void swap(VectorAlloc& v)
 	{	
-		SizeMismatch<Dynamic, Dynamic>::test(my_size, v.my_size);
+		if(my_data != 0 && v.my_data != 0)
+			::TooN::SizeMismatch<Dynamic, Dynamic>::test(my_size, v.my_size);
 		std::swap(my_data, v.my_data);
+		std::swap(my_size, v.my_size);
 	}	
 
 	protected:
@@ -237,11 +424,31 @@ template<class Precision> struct VectorAlloc<Dynamic, Precision>: public Default
 			return my_data;
 		};
 
-		void try_destructive_resize(int)
-		{}
+	private:
+		template<int S> struct SFINAE_dummy{typedef void type;};
 
-		template<class Op> void try_destructive_resize(const Operator<Op>&) 
+	protected:
+
+		//See VectorAlloc<Resizable> for the use of SFINAE here.
+		template<class Op> 
+		typename SFINAE_dummy<sizeof(&Operator<Op>::size)>::type try_destructive_resize(const Operator<Op>& op) 
+		{
+			try_destructive_resize(op.size());
+		}
+		
+		template<class Op>
+		void try_destructive_resize(const Op&)
 		{}
+
+		//The size can not change, unless the storage was taken by a move.
+		void try_destructive_resize(int newsize)
+		{
+			if(my_data == 0) {
+				my_data = allocate<Precision>(newsize);
+				my_size = newsize;
+				debug_initialize(my_data, my_size);
+			}
+		}
 };
 
 
@@ -261,18 +468,30 @@ template<class Precision> struct VectorAlloc<Resizable, Precision>: public Defau
 		}
 
 		VectorAlloc(int s)
-		:numbers(s)
 		{ 
+			resize_storage(s);
 			debug_initialize(data(), size());	
 		}
 
 		template <class Op>
 		VectorAlloc(const Operator<Op>& op) 
-		:numbers(op.size()) 
 		{
+			resize_storage(op.size());
 			debug_initialize(data(), size());	
 		}
 
+		VectorAlloc(const VectorAlloc& from)
+		{
+			resize_storage(from.size());
+			TOON_INSTRUMENT_COPY(sizeof(Precision)*numbers.size());
+			for(int i=0; i < size(); i++)
+				numbers[i] = from.numbers[i];
+		}
+
+		VectorAlloc(VectorAlloc&&) = default;
+		VectorAlloc& operator=(const VectorAlloc&) = default;
+		VectorAlloc& operator=(VectorAlloc&&) = default;
+
 		int size() const {
 			return numbers.size();
 		}
@@ -329,21 +548,154 @@ template<class Precision> struct VectorAlloc<Resizable, Precision>: public Defau
 
 		void try_destructive_resize(int newsize)
 		{
-			numbers.resize(newsize);
+			resize_storage(newsize);
 			debug_initialize(data(), newsize);
 		}
 
+	private:
+		//The storage is reallocated only if it grows beyond the capacity.
+		void resize_storage(int s)
+		{
+			if(s > static_cast<int>(numbers.capacity()))
+				note_heap_allocation<Precision>(s);
+			numbers.resize(s);
+		}
+
 	public:
 
 		void resize(int s)
 		{
 			int old_size = size();
-			numbers.resize(s);
+			resize_storage(s);
 			if(s > old_size)
 				debug_initialize(data()+old_size, s-old_size);
 		}
 };
 
+///@internal
+///@brief Check that a run-time size fits in a compile-time capacity.
+///@ingroup gInternal
+inline void check_bounded_size(int s, int cap)
+{
+	if(s < 0 || s > cap)
+	{
+		#ifdef TOON_TEST_INTERNALS
+			throw Internal::BoundedOverflow();
+		#elif !defined TOON_NDEBUG_SIZE
+			std::cerr << "TooN Bounded capacity exceeded" << std::endl;
+			std::abort();
+		#endif
+	}
+}
+
+///@internal
+///@brief Allocate memory for a Vector with a run-time size and a
+///compile-time capacity. The data is always stored in place, so the
+///heap is never used. The vector may be resized up to its capacity.
+///New elements available after a resize are treated as uninitialized.
+///@ingroup gInternal
+template<int Cap, class Precision> struct BoundedVectorAlloc: public DefaultTypes<Precision> {
+
+	BoundedVectorAlloc()
+	:my_size(0)
+	{}
+
+	BoundedVectorAlloc(int s)
+	:my_size(0)
+	{
+		resize_storage(s);
+		debug_initialize(my_data, my_size);
+	}
+
+	template <class Op>
+	BoundedVectorAlloc(const Operator<Op>& op) 
+	:my_size(0)
+	{
+		resize_storage(op.size());
+		debug_initialize(my_data, my_size);
+	}
+
+	//Only the elements in use are copied.
+	BoundedVectorAlloc(const BoundedVectorAlloc& from)
+	:my_size(from.my_size)
+	{
+		TOON_INSTRUMENT_COPY(sizeof(Precision)*my_size);
+		for(int i=0; i < my_size; i++)
+			my_data[i] = from.my_data[i];
+	}
+
+	int size() const {
+		return my_size;
+	}
+
+	///Return the maximum size of the vector.
+	static int capacity() {
+		return Cap;
+	}
+
+	Precision *get_data_ptr()
+	{
+		return my_data;
+	};
+
+	const Precision *get_data_ptr() const
+	{
+		return my_data;
+	}
+
+	void resize(int s)
+	{
+		int old_size = my_size;
+		resize_storage(s);
+		if(s > old_size)
+			debug_initialize(my_data+old_size, s-old_size);
+	}
+
+	protected:
+
+		Precision *data()
+		{
+			return my_data;
+		};
+
+		const Precision *data() const
+		{
+			return my_data;
+		};
+
+	private:
+		template<int S> struct SFINAE_dummy{typedef void type;};
+
+		void resize_storage(int s)
+		{
+			check_bounded_size(s, Cap);
+			my_size = s;
+		}
+
+	protected:
+
+		//See VectorAlloc<Resizable> for the use of SFINAE here.
+		template<class Op> 
+		typename SFINAE_dummy<sizeof(&Operator<Op>::size)>::type try_destructive_resize(const Operator<Op>& op) 
+		{
+			try_destructive_resize(op.size());
+		}
+		
+		template<class Op>
+		void try_destructive_resize(const Op&)
+		{}
+
+		void try_destructive_resize(int newsize)
+		{
+			resize_storage(newsize);
+			debug_initialize(my_data, newsize);
+		}
+
+	private:
+		Precision my_data[Cap];
+		int my_size;
+};
+
 ///@internal
 ///@brief Hold a pointer to yield a statically sized slice of a Vector.
 ///Not resizable.
@@ -456,6 +808,9 @@ template<int s> struct SizeHolder
 	int size() const{
 		return s;
 	}
+
+	///The size is static, so this does nothing.
+	void set_size(int){}
 };
 
 ///@internal
@@ -469,11 +824,16 @@ template<> struct SizeHolder<-1>
 	:my_size(s){}
 	///@}
 
-	const int my_size; ///<The size
+	int my_size; ///<The size
 	///Return the size
 	int size() const {
 		return my_size;
 	}
+
+	///Change the size (only used when a matrix is moved from)
+	void set_size(int s){
+		my_size = s;
+	}
 };
 
 ///@internal
@@ -499,6 +859,10 @@ template<int S> struct RowSizeHolder: private SizeHolder<S>
 	
 	///Return the number of rows.
 	int num_rows() const {return SizeHolder<S>::size();}
+
+	protected:
+		///Change the number of rows, if it is dynamic.
+		void set_num_rows(int r) {SizeHolder<S>::set_size(r);}
 };
 
 
@@ -525,12 +889,16 @@ template<int S> struct ColSizeHolder: private SizeHolder<S>
 
 	///Return the number of columns.
 	int num_cols() const {return SizeHolder<S>::size();}	
+
+	protected:
+		///Change the number of columns, if it is dynamic.
+		void set_num_cols(int c) {SizeHolder<S>::set_size(c);}
 };
 
 
 
-template<int R, int C, class Precision, bool FullyStatic=(R>=0 && C>=0)> 
-struct MatrixAlloc: public StaticSizedAllocator<R*C, Precision>
+template<int R, int C, class Precision, bool FullyStatic=(R>=0 && C>=0), int Storage=AutoStorage> 
+struct MatrixAlloc: public StaticSizedAllocator<R*C, Precision, Storage>
 {
 	MatrixAlloc(int,int)
 	{}
@@ -542,25 +910,37 @@ struct MatrixAlloc: public StaticSizedAllocator<R*C, Precision>
 	MatrixAlloc(const Operator<Op>&)
 	{}
 
-	int num_rows() const {
+	template<int N, class P2>
+	constexpr MatrixAlloc(Elements e, const P2 (&vals)[N])
+	:StaticSizedAllocator<R*C, Precision, Storage>(e, vals)
+	{}
+
+	constexpr int num_rows() const {
 		return R;
 	}
 
-	int num_cols() const {
+	constexpr int num_cols() const {
 		return C;
 	}
 
-	using  StaticSizedAllocator<R*C, Precision>::my_data;
+	using  StaticSizedAllocator<R*C, Precision, Storage>::my_data;
 
 	Precision* get_data_ptr()
 	{
 		return my_data;
 	}
 
-	const Precision* get_data_ptr() const 
+	constexpr const Precision* get_data_ptr() const 
 	{
 		return my_data;
 	}
+
+	protected:
+		///Allocate the storage again if a move took it. The size is static.
+		void reallocate_moved_from(int, int)
+		{
+			StaticSizedAllocator<R*C, Precision, Storage>::reallocate_moved_from();
+		}
 };
 
 
@@ -568,7 +948,7 @@ template<int R, int C, class Precision> struct MatrixAlloc<R, C, Precision, fals
 	: public RowSizeHolder<R>,
 	ColSizeHolder<C>
 {
-	Precision* const my_data;
+	Precision* my_data;
 
 	using RowSizeHolder<R>::num_rows;
 	using ColSizeHolder<C>::num_cols;
@@ -577,17 +957,30 @@ template<int R, int C, class Precision> struct MatrixAlloc<R, C, Precision, fals
 	MatrixAlloc(const MatrixAlloc& m)
 		:RowSizeHolder<R>(m.num_rows()),
 		 ColSizeHolder<C>(m.num_cols()),
-		 my_data(new Precision[num_rows()*num_cols()]) {
+		 my_data(allocate<Precision>(num_rows()*num_cols())) {
 		const int size=num_rows()*num_cols();
+		TOON_INSTRUMENT_COPY(sizeof(Precision)*size);
 		for(int i=0; i < size; i++) {
 			my_data[i] = m.my_data[i];
 		}
 	}
 
+	//The moved from matrix is left with no storage, and no rows or columns
+	//where those are dynamic. Assigning to it allocates the storage again.
+	MatrixAlloc(MatrixAlloc&& m) noexcept
+		:RowSizeHolder<R>(m.num_rows()),
+		 ColSizeHolder<C>(m.num_cols()),
+		 my_data(m.my_data)
+	{
+		m.my_data = 0;
+		m.set_num_rows(0);
+		m.set_num_cols(0);
+	}
+
 	MatrixAlloc(int r, int c)
 	:RowSizeHolder<R>(r),
 	 ColSizeHolder<C>(c),
-	 my_data(new Precision[num_rows()*num_cols()]) 
+	 my_data(allocate<Precision>(num_rows()*num_cols())) 
 	{
 		debug_initialize(my_data, num_rows()*num_cols());	
 	}
@@ -595,7 +988,7 @@ template<int R, int C, class Precision> struct MatrixAlloc<R, C, Precision, fals
 	template <class Op>	MatrixAlloc(const Operator<Op>& op)
 		:RowSizeHolder<R>(op),
 		 ColSizeHolder<C>(op),
-		 my_data(new Precision[num_rows()*num_cols()])
+		 my_data(allocate<Precision>(num_rows()*num_cols()))
 	{
 		debug_initialize(my_data, num_rows()*num_cols());	
 	}
@@ -604,6 +997,21 @@ template<int R, int C, class Precision> struct MatrixAlloc<R, C, Precision, fals
 		delete[] my_data;
 	}
 
+	//A moved from matrix may take the storage of any other.
+	void swap(MatrixAlloc& m)
+	{
+		if(my_data != 0 && m.my_data != 0) {
+			::TooN::SizeMismatch<R, R>::test(num_rows(), m.num_rows());
+			::TooN::SizeMismatch<C, C>::test(num_cols(), m.num_cols());
+		}
+		const int r = num_rows(), c = num_cols();
+		set_num_rows(m.num_rows());
+		set_num_cols(m.num_cols());
+		m.set_num_rows(r);
+		m.set_num_cols(c);
+		std::swap(my_data, m.my_data);
+	}
+
 	Precision* get_data_ptr()
 	{
 		return my_data;
@@ -613,6 +1021,86 @@ template<int R, int C, class Precision> struct MatrixAlloc<R, C, Precision, fals
 	{
 		return my_data;
 	}
+
+	protected:
+		///Allocate the storage again, with the given size, if a move took it.
+		void reallocate_moved_from(int r, int c)
+		{
+			if(my_data == 0) {
+				set_num_rows(r);
+				set_num_cols(c);
+				my_data = allocate<Precision>(num_rows()*num_cols());
+				debug_initialize(my_data, num_rows()*num_cols());
+			}
+		}
+
+		using RowSizeHolder<R>::set_num_rows;
+		using ColSizeHolder<C>::set_num_cols;
+};
+
+
+///@internal
+///@brief Allocate memory for a row major Matrix with run-time sizes and
+///compile-time capacities. The data is always stored in place, so the heap
+///is never used. Only the first num_rows()*num_cols() elements are used.
+///@ingroup gInternal
+template<int R, int C, int RCap, int CCap, class Precision> struct BoundedMatrixAlloc
+	: public RowSizeHolder<R>,
+	ColSizeHolder<C>
+{
+	using RowSizeHolder<R>::num_rows;
+	using ColSizeHolder<C>::num_cols;
+
+	//Only the elements in use are copied.
+	BoundedMatrixAlloc(const BoundedMatrixAlloc& m)
+		:RowSizeHolder<R>(m.num_rows()),
+		 ColSizeHolder<C>(m.num_cols())
+	{
+		const int size=num_rows()*num_cols();
+		TOON_INSTRUMENT_COPY(sizeof(Precision)*size);
+		for(int i=0; i < size; i++) {
+			my_data[i] = m.my_data[i];
+		}
+	}
+
+	BoundedMatrixAlloc(int r, int c)
+	:RowSizeHolder<R>(r),
+	 ColSizeHolder<C>(c)
+	{
+		check_sizes();
+	}
+
+	template <class Op>	BoundedMatrixAlloc(const Operator<Op>& op)
+		:RowSizeHolder<R>(op),
+		 ColSizeHolder<C>(op)
+	{
+		check_sizes();
+	}
+
+	Precision* get_data_ptr()
+	{
+		return my_data;
+	}
+
+	const Precision* get_data_ptr() const 
+	{
+		return my_data;
+	}
+
+	Precision my_data[RCap*CCap];
+
+	protected:
+		///Bounded storage is never moved from.
+		void reallocate_moved_from(int, int)
+		{}
+
+	private:
+		void check_sizes()
+		{
+			check_bounded_size(num_rows(), RCap);
+			check_bounded_size(num_cols(), CCap);
+			debug_initialize(my_data, num_rows()*num_cols());
+		}
 };
 
 
@@ -640,8 +1128,40 @@ template<int R, int C, class Precision> struct MatrixSlice
 		 ColSizeHolder<C>(op),
 		 my_data(op.data())
 	{}
+
+	protected:
+		///Slices do not own their data, so they are never moved from.
+		void reallocate_moved_from(int, int)
+		{}
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Move assignment
+
+TOON_CREATE_METHOD_DETECTOR(swap);
+
+///@internal
+///@brief Move assignment of a Vector or Matrix. If the storage can be swapped
+///(i.e. the object owns data on the heap) then it is, so no data is copied.
+///Otherwise, for instance for slices, the data is copied as usual.
+///@ingroup gInternal
+template<class T, bool has_swap = Has_swap_Method<T>::Has> struct MoveAssign
+{
+	static void assign(T& to, T& from)
+	{
+		to = static_cast<const T&>(from);
+	}
 };
 
+template<class T> struct MoveAssign<T, true>
+{
+	static void assign(T& to, T& from)
+	{
+		to.swap(from);
+	}
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -651,13 +1171,13 @@ template<int R, int C, class Precision> struct MatrixSlice
 template<int s> struct StrideHolder
 {
 	//Constructos ignore superfluous arguments
-	StrideHolder(){}
-	StrideHolder(int){}
+	constexpr StrideHolder(){}
+	constexpr StrideHolder(int){}
 
 	template<class Op>
-	StrideHolder(const Operator<Op>&) {}
+	constexpr StrideHolder(const Operator<Op>&) {}
 
-	int stride() const{
+	constexpr int stride() const{
 		return s;
 	}
 };
@@ -671,7 +1191,7 @@ template<> struct StrideHolder<-1>
 	StrideHolder(const Operator<Op>& op) : my_stride(op.stride()) {}
 
 	const int my_stride;
-	int stride() const {
+	constexpr int stride() const {
 		return my_stride;
 	}
 };
@@ -682,7 +1202,7 @@ template<int S> struct RowStrideHolder: public StrideHolder<S>
 	RowStrideHolder(int i)
 	:StrideHolder<S>(i){}
 
-	RowStrideHolder()
+	constexpr RowStrideHolder()
 	{}
 
 	template<class Op>
@@ -698,7 +1218,7 @@ template<int S> struct ColStrideHolder: public StrideHolder<S>
 	ColStrideHolder(int i)
 	:StrideHolder<S>(i){}
 
-	ColStrideHolder()
+	constexpr ColStrideHolder()
 	{}
 
 	template<class Op>
@@ -0,0 +1,278 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+namespace TooN {
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Storage with a run-time size and a compile-time capacity
+//
+
+namespace Internal
+{
+	template<int RowStride, int ColStride, int RCap, int CCap> struct BoundedSlice;
+}
+
+///Storage policy for vectors and matrices whose sizes are only known at run
+///time, but are never larger than a fixed capacity. The data is stored in
+///place (i.e. on the stack for local variables), so the heap is never used,
+///e.g.
+///@code
+///	Vector<Dynamic, double, Bounded<12> > v(n);            //Any n up to 12
+///	v.resize(n+1);
+///	Matrix<Dynamic, Dynamic, double, Bounded<6,12> > J(m, n); //Any m up to 6, n up to 12
+///@endcode
+///Bounded vectors are resized on assignment, in the same way as Resizable
+///vectors. Bounded matrices are row major and not resizable. Exceeding the
+///capacity is a fatal error.
+///
+///The results of operators (and of decompositions declared with a Bounded
+///layout) inherit the capacity of their arguments, so arithmetic on Bounded
+///objects does not use the heap either. This includes the transpose. See
+///\ref sNoHeap.
+///@param Cap Capacity of a vector, or the number of rows of a matrix
+///@param ColCap Capacity of the number of columns of a matrix
+///@ingroup gLinAlg
+template<int Cap, int ColCap=Cap>
+struct Bounded
+{
+	template<int Size, typename Precision>
+	struct VLayout
+		: public Internal::GenericVBase<Size, Precision, 1, Internal::BoundedVectorAlloc<Cap, Precision> >
+	{
+		static_assert(Size == Dynamic, "Bounded vectors must be declared with a Dynamic size");
+		static_assert(Cap > 0, "The capacity of a Bounded vector must be positive");
+
+		VLayout(){}
+
+		VLayout(int s)
+			:Internal::GenericVBase<Size, Precision, 1, Internal::BoundedVectorAlloc<Cap, Precision> >(s)
+		{}
+
+		template<class Op>
+		VLayout(const Operator<Op>& op)
+			:Internal::GenericVBase<Size, Precision, 1, Internal::BoundedVectorAlloc<Cap, Precision> >(op) {}
+	};
+
+	template<int Rows, int Cols, class Precision>
+	struct MLayout
+		: public Internal::GenericMBase<Rows, Cols, Precision, (Cols==-1?-2:Cols), 1, Internal::BoundedMatrixAlloc<Rows, Cols, Cap, ColCap, Precision> >
+	{
+		typedef Internal::GenericMBase<Rows, Cols, Precision, (Cols==-1?-2:Cols), 1, Internal::BoundedMatrixAlloc<Rows, Cols, Cap, ColCap, Precision> > Base;
+		static_assert(Cap > 0 && ColCap > 0, "The capacity of a Bounded matrix must be positive");
+		static_assert(Rows <= Cap && Cols <= ColCap, "A static size of a Bounded matrix exceeds its capacity");
+
+		MLayout(int rows, int cols)
+			:Base(rows, cols)
+		{}
+
+		template<class Op>
+		MLayout(const Operator<Op>& op)
+			:Base(op)
+		{}
+
+		//The transpose retains the capacity, so that expressions such as
+		//J.T()*J do not need the heap.
+		Matrix<Cols, Rows, Precision, Internal::BoundedSlice<Base::SliceColStride, Base::SliceRowStride, ColCap, Cap> > T(){
+			return Matrix<Cols, Rows, Precision, Internal::BoundedSlice<Base::SliceColStride, Base::SliceRowStride, ColCap, Cap> >(this->my_data, this->num_cols(), this->num_rows(), this->colstride(), this->rowstride(), Internal::Slicing());
+		}
+
+		const Matrix<Cols, Rows, const Precision, Internal::BoundedSlice<Base::SliceColStride, Base::SliceRowStride, ColCap, Cap> > T() const{
+			return Matrix<Cols, Rows, const Precision, Internal::BoundedSlice<Base::SliceColStride, Base::SliceRowStride, ColCap, Cap> >(this->my_data, this->num_cols(), this->num_rows(), this->colstride(), this->rowstride(), Internal::Slicing());
+		}
+	};
+};
+
+namespace Internal
+{
+	///@internal
+	///A slice of a Bounded matrix which remembers the capacity of the
+	///matrix. This is only used for the transpose.
+	///@ingroup gInternal
+	template<int RowStride, int ColStride, int RCap, int CCap> struct BoundedSlice
+	{
+		template<int Rows, int Cols, class Precision> struct MLayout: public GenericMBase<Rows, Cols, Precision, RowStride, ColStride, MatrixSlice<Rows, Cols, Precision> >
+		{
+			typedef GenericMBase<Rows, Cols, Precision, RowStride, ColStride, MatrixSlice<Rows, Cols, Precision> > Base;
+
+			MLayout(Precision* p, int rows, int cols, int rowstride, int colstride)
+				:Base(p, rows, cols, rowstride, colstride)
+			{
+			}
+
+			Matrix<Cols, Rows, Precision, BoundedSlice<ColStride, RowStride, CCap, RCap> > T(){
+				return Matrix<Cols, Rows, Precision, BoundedSlice<ColStride, RowStride, CCap, RCap> >(this->my_data, this->num_cols(), this->num_rows(), this->colstride(), this->rowstride(), Slicing());
+			}
+
+			const Matrix<Cols, Rows, const Precision, BoundedSlice<ColStride, RowStride, CCap, RCap> > T() const{
+				return Matrix<Cols, Rows, const Precision, BoundedSlice<ColStride, RowStride, CCap, RCap> >(this->my_data, this->num_cols(), this->num_rows(), this->colstride(), this->rowstride(), Slicing());
+			}
+		};
+	};
+
+	////////////////////////////////////////////////////////////////////////////////
+	//
+	// Choice of storage for the results of operators. 
+	//
+	// Capacities are 0 when there is no bound, i.e. the heap is used.
+
+	///@internal
+	///Capacity of a vector with the given storage policy.
+	///@ingroup gInternal
+	template<class Base> struct VectorCapacity
+	{
+		static const int value = 0;
+	};
+
+	template<int Cap, int ColCap> struct VectorCapacity<Bounded<Cap, ColCap> >
+	{
+		static const int value = Cap;
+	};
+
+	///@internal
+	///Capacities of a matrix with the given layout.
+	///@ingroup gInternal
+	template<class Layout> struct MatrixCapacity
+	{
+		static const int rows = 0;
+		static const int cols = 0;
+	};
+
+	template<int Cap, int ColCap> struct MatrixCapacity<Bounded<Cap, ColCap> >
+	{
+		static const int rows = Cap;
+		static const int cols = ColCap;
+	};
+
+	template<int RowStride, int ColStride, int RCap, int CCap> struct MatrixCapacity<BoundedSlice<RowStride, ColStride, RCap, CCap> >
+	{
+		static const int rows = RCap;
+		static const int cols = CCap;
+	};
+
+	///@internal
+	///Capacity of the result of an operation on two objects. Both sizes
+	///are known to be equal, so the smaller bound applies.
+	///@ingroup gInternal
+	template<int C1, int C2> struct MinCapacity
+	{
+		static const int value = C1 == 0 ? C2 : (C2 == 0 ? C1 : (C1 < C2 ? C1 : C2));
+	};
+
+	///@internal
+	///Storage policy for a vector result of the given size, capacity and
+	///placement (see StaticStorage). 
+	///@ingroup gInternal
+	template<int Size, int Cap, int Storage=AutoStorage> struct VectorResultBase
+	{
+		template<int choice, int dummy> struct Choose
+		{
+			typedef VBase type;
+		};
+
+		template<int dummy> struct Choose<1, dummy>
+		{
+			typedef Bounded<Cap> type;
+		};
+
+		template<int dummy> struct Choose<2, dummy>
+		{
+			typedef Stack type;
+		};
+
+		typedef typename Choose<((Size == Dynamic && Cap > 0) ? 1 : (Size >= 0 && Storage == StackStorage) ? 2 : 0), 0>::type type;
+	};
+
+	///@internal
+	///As VectorResultBase, for the result of an operation on two vectors.
+	///@ingroup gInternal
+	template<int Size, class B1, class B2> struct PairwiseVectorBase
+	{
+		typedef typename VectorResultBase<Size, MinCapacity<VectorCapacity<B1>::value, VectorCapacity<B2>::value>::value, CombinedStorage<B1, B2>::value>::type type;
+	};
+
+	///@internal
+	///As VectorResultBase, for the result of an operation on one vector
+	///which preserves the size.
+	///@ingroup gInternal
+	template<int Size, class Base> struct VectorBase
+	{
+		typedef typename VectorResultBase<Size, VectorCapacity<Base>::value, StorageOf<Base>::value>::type type;
+	};
+
+	///@internal
+	///Storage policy for a matrix result of the given size, capacity and
+	///placement. Bounded storage is used if there is a dynamic dimension and 
+	///every dynamic dimension is bounded.
+	///@ingroup gInternal
+	template<int Rows, int Cols, int RCap, int CCap, int Storage=AutoStorage> struct MatrixResultBase
+	{
+		static const int rows = Rows == Dynamic ? RCap : Rows;
+		static const int cols = Cols == Dynamic ? CCap : Cols;
+
+		template<int choice, int dummy> struct Choose
+		{
+			typedef RowMajor type;
+		};
+
+		template<int dummy> struct Choose<1, dummy>
+		{
+			typedef Bounded<rows, cols> type;
+		};
+
+		template<int dummy> struct Choose<2, dummy>
+		{
+			typedef Stack type;
+		};
+
+		static const bool is_static = Rows >= 0 && Cols >= 0;
+		typedef typename Choose<((!is_static && rows > 0 && cols > 0) ? 1 : (is_static && Storage == StackStorage) ? 2 : 0), 0>::type type;
+	};
+
+	///@internal
+	///As MatrixResultBase, for the result of an operation on two matrices
+	///of the same size.
+	///@ingroup gInternal
+	template<int Rows, int Cols, class L1, class L2> struct PairwiseMatrixBase
+	{
+		typedef typename MatrixResultBase<Rows, Cols,
+			MinCapacity<MatrixCapacity<L1>::rows, MatrixCapacity<L2>::rows>::value,
+			MinCapacity<MatrixCapacity<L1>::cols, MatrixCapacity<L2>::cols>::value,
+			CombinedStorage<L1, L2>::value>::type type;
+	};
+
+	///@internal
+	///As MatrixResultBase, for the result of an operation on one matrix
+	///which preserves the size.
+	///@ingroup gInternal
+	template<int Rows, int Cols, class Layout> struct MatrixBase
+	{
+		typedef typename MatrixResultBase<Rows, Cols, MatrixCapacity<Layout>::rows, MatrixCapacity<Layout>::cols, StorageOf<Layout>::value>::type type;
+	};
+}
+
+}
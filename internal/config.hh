@@ -1,3 +1,4 @@
 /* internal/config.hh.  Generated from config.hh.in by configure.  */
 #define TOON_USE_LAPACK 1
 /* #undef TOON_DEFAULT_PRECISION */
+/* #undef TOON_MAX_BYTES_ON_STACK */
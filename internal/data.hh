@@ -37,14 +37,19 @@ namespace TooN{
 	///@ingroup gInternal
 	template<int N, class P> struct Operator<Internal::Data<N, P> >
 	{
+		template<class... Args>
+		constexpr Operator(Internal::Elements, const Args&... args)
+		:vals{Internal::implicit_cast<P>(args)...}
+		{}
+
 		P vals[N];
 
 		template<int R, int C, class T, class B>
 		void eval(Matrix<R, C, T, B>& m) const
 		{
 			SizeMismatch<(R==-1?-1:(C==-1?-1:(R*C))), N>:: test(m.num_rows()*m.num_cols(), N);
-			for(int r=0, n=0; r < R; r++)
-				for(int c=0; c < C; c++, n++)
+			for(int r=0, n=0; r < m.num_rows(); r++)
+				for(int c=0; c < m.num_cols(); c++, n++)
 					m[r][c] = vals[n];
 		}
 
@@ -57,31 +62,4 @@ namespace TooN{
 		}
 	};
 
-	#ifdef DOXYGEN_INCLUDE_ONLY_FOR_DOCS
-	
-		///Package up the function arguments as some data for filling matrices.
-		///Matrices are filled in row major order.
-		///For example:
-		///@code
-		///   double theta = 2;
-		///   Matrix<2> rotation = data( cos(theta), sin(theta)
-		///                             -sin(theta), cos(theta));
-		///@endcode
-		///See also TooN::wrapMatrix().
-		///@param a The first data element.
-		///@ingroup gLinAlg
-		inline Operator<Internal::Data<N, double> > Data(double a, ...);
-
-		///Package up the function arguments as some data for filling matrices.
-		///Any type can be uses. Matrices are filled in row-major order.
-		///@code
-		///   Matrix<2,2,float> rotation = data(1f, 2f, 3f, 4f);
-		///@endcode
-		///See also TooN::wrapMatrix().
-		///@param a The first data element.
-		///@ingroup gLinAlg
-		template<typename Precision> inline Operator<Internal::Data<N, Precision> > Data(const Precision& a, ...);
-
-	#endif
-
 }
@@ -31,7 +31,7 @@ namespace Internal
 	
 
 	#if defined  TOON_CHECK_BOUNDS  || defined TOON_TEST_INTERNALS
-		static inline void check_index(int s, int i)
+		static constexpr void check_index(int s, int i)
 		{
 			if(i<0 || i >= s)
 			{
@@ -47,7 +47,7 @@ namespace Internal
 		///@internal
 		///Function used to check bounds.
 		///By default it does nothing. See \ref sDebug.
-		static inline void check_index(int, int){}
+		static constexpr void check_index(int, int){}
 	#endif
 
 	#if defined TOON_INITIALIZE_SNAN
@@ -35,12 +35,65 @@ namespace TooN {
 		//Dummy struct for Diagonal operator
 		template<int Size, typename Precision, typename Base>
 		struct DiagMatrixOp;
+
+		//Dummy struct for the sum of a matrix and a diagonal matrix
+		template<int R, int C, typename P, typename B, int Size, typename Pd, typename Bd>
+		struct AddDiagonal;
 	}
 
-	template<int Size, typename Precision, typename Base>
-	struct Operator<Internal::DiagMatrixOp<Size, Precision, Base> >
+	///@internal
+	///@brief The sum of a matrix and a diagonal matrix, either of which may be
+	///negated. Evaluating it costs one pass over the matrix, with no temporary.
+	///@ingroup gInternal
+	template<int R, int C, typename P, typename B, int Size, typename Pd, typename Bd>
+	struct Operator<Internal::AddDiagonal<R, C, P, B, Size, Pd, Bd> >
+	{
+		const Vector<Size, Pd, Bd>& d; ///<Leading diagonal of the diagonal matrix
+		const Matrix<R, C, P, B>& m;   ///<Matrix to which the diagonal is added
+		bool negate_m;                 ///<Whether m is subtracted
+		bool negate_d;                 ///<Whether d is subtracted
+
+		///@name Construction
+		///@{
+		Operator(const Vector<Size, Pd, Bd>& d_, const Matrix<R, C, P, B>& m_, bool nm, bool nd)
+			:d(d_), m(m_), negate_m(nm), negate_d(nd) {}
+		///@}
+
+		///@name Operator members
+		///@{
+		template<int R1, int C1, class P1, class B1>
+		void eval(Matrix<R1, C1, P1, B1>& mm) const{
+			//Each diagonal element is read before anything in its row is
+			//written, so d may refer to the diagonal of mm.
+			for(int r=0; r < m.num_rows(); r++)
+			{
+				const P1 dr = negate_d ? -d[r] : d[r];
+				for(int c=0; c < m.num_cols(); c++)
+					mm[r][c] = negate_m ? -m[r][c] : m[r][c];
+				mm[r][r] += dr;
+			}
+		}
+		///@}
+
+		///@name Sized operator members
+		///@{
+		int num_rows() const
+		{
+			return m.num_rows();
+		}
+		int num_cols() const
+		{
+			return m.num_cols();
+		}
+		///@}
+	};
+
+	template<int Size, typename Pr, typename Base>
+	struct Operator<Internal::DiagMatrixOp<Size, Pr, Base> >
 	{
 		public:
+		typedef Pr Precision;
+
 		///@name Constructors
 		///@{
 
@@ -69,6 +122,11 @@ namespace TooN {
 		{
 			my_vector=from;
 		}
+
+		// constructor taking over the storage of a temporary vector
+		inline Operator(Vector<Size,Precision,Base>&& from)
+			: my_vector(std::move(from))
+		{}
 		///@}
 
 
@@ -81,6 +139,53 @@ namespace TooN {
 			m.diagonal_slice() = my_vector;
 		}
 
+		template<int R, int C, class P, class B>
+		void plusequals(Matrix<R,C,P,B>& m) const {
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(my_vector.size(), m.num_rows());
+			m.diagonal_slice() += my_vector;
+		}
+
+		template<int R, int C, class P, class B>
+		void minusequals(Matrix<R,C,P,B>& m) const {
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(my_vector.size(), m.num_rows());
+			m.diagonal_slice() -= my_vector;
+		}
+
+		template<int R, int C, class P, class B>
+		Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> > add(const Matrix<R,C,P,B>& m) const {
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(my_vector.size(), m.num_rows());
+			return Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> >(my_vector, m, false, false);
+		}
+
+		template<int R, int C, class P, class B>
+		Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> > rsubtract(const Matrix<R,C,P,B>& m) const {
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(my_vector.size(), m.num_rows());
+			return Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> >(my_vector, m, false, true);
+		}
+
+		template<int R, int C, class P, class B>
+		Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> > lsubtract(const Matrix<R,C,P,B>& m) const {
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(my_vector.size(), m.num_rows());
+			return Operator<Internal::AddDiagonal<R, C, P, B, Size, Precision, Base> >(my_vector, m, true, false);
+		}
+
+		///@name Sized operator members
+		///@{
+		int num_rows() const
+		{
+			return my_vector.size();
+		}
+		int num_cols() const
+		{
+			return my_vector.size();
+		}
+		///@}
+
 		///The vector used to hold the leading diagonal.
 		Vector<Size,Precision,Base> my_vector;
 	};
@@ -134,6 +239,11 @@ public:
 	{
 		this->my_vector=from;
 	}
+
+	// constructor taking over the storage of a temporary vector
+	inline DiagonalMatrix(Vector<Size,Precision,Base>&& from)
+		: Operator<Internal::DiagMatrixOp<Size, Precision, Base> >(std::move(from))
+	{}
 	///@}
 
 
@@ -153,7 +263,7 @@ public:
 		return this->my_vector.as_slice();
 	}
 
-	DiagonalMatrix<Size, Precision> operator-() const
+	DiagonalMatrix<Size, Precision, typename Internal::VectorBase<Size, Base>::type> operator-() const
 	{
 		return -this->my_vector;
 	}
@@ -161,36 +271,77 @@ public:
 
 
 template<int S1, typename P1, typename B1, int S2, typename P2, typename B2>
-inline Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type>
+inline Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type>
 operator*(const DiagonalMatrix<S1,P1,B1>& d, const Vector<S2,P2,B2>& v){
 	return diagmult(d.my_vector,v);
 }
 
 template<int S1, typename P1, typename B1, int S2, typename P2, typename B2>
-inline Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type>
+inline Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type>
 operator*( const Vector<S1,P1,B1>& v, const DiagonalMatrix<S2,P2,B2>& d){
 	return diagmult(v,d.my_vector);
 }
 
 // perhaps not the safest way to do this as we're returning the same operator used to normally make vectors
 template<int S1, typename P1, typename B1, int S2, typename P2, typename B2>
-inline DiagonalMatrix<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type>
+inline DiagonalMatrix<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type>
 operator*( const DiagonalMatrix<S1,P1,B1>& d1, const DiagonalMatrix<S2,P2,B2>& d2){
 	SizeMismatch<S1,S2>::test(d1.my_vector.size(),d2.my_vector.size());
 	return Operator<Internal::VPairwise<Internal::Multiply,S1,P1,B1,S2,P2,B2> >(d1.my_vector,d2.my_vector);
 }
 
 template<int R, int C, int Size, typename P1, typename P2, typename B1, typename B2>
-Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type>
+Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type, typename Internal::MatrixBase<R, C, B1>::type>
 operator* (const Matrix<R, C, P1, B1>& m, const DiagonalMatrix<Size, P2, B2>& d){
 	return diagmult(m,d.my_vector);
 }
 
 template<int R, int C, typename P1, typename B1, int Size, typename P2, typename B2> 
-Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type>
+Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type, typename Internal::MatrixBase<R, C, B2>::type>
 operator* (const DiagonalMatrix<Size,P1,B1>& d, const Matrix<R,C,P2,B2>& m)
 {
 	return diagmult(d.my_vector, m);
 }
 
+template<int S1, typename P1, typename B1, int S2, typename P2, typename B2>
+inline DiagonalMatrix<Internal::Sizer<S1,S2>::size, typename Internal::AddType<P1,P2>::type>
+operator+(const DiagonalMatrix<S1,P1,B1>& d1, const DiagonalMatrix<S2,P2,B2>& d2){
+	return d1.my_vector + d2.my_vector;
+}
+
+template<int S1, typename P1, typename B1, int S2, typename P2, typename B2>
+inline DiagonalMatrix<Internal::Sizer<S1,S2>::size, typename Internal::SubtractType<P1,P2>::type>
+operator-(const DiagonalMatrix<S1,P1,B1>& d1, const DiagonalMatrix<S2,P2,B2>& d2){
+	return d1.my_vector - d2.my_vector;
+}
+
+template<int Size, typename P1, typename B1, typename P2>
+inline DiagonalMatrix<Size, typename Internal::Multiply::Return<P1,P2>::Type>
+operator*(const DiagonalMatrix<Size,P1,B1>& d, const P2& s){
+	return d.my_vector * s;
+}
+
+template<int Size, typename P1, typename P2, typename B2>
+inline DiagonalMatrix<Size, typename Internal::Multiply::Return<P1,P2>::Type>
+operator*(const P1& s, const DiagonalMatrix<Size,P2,B2>& d){
+	return s * d.my_vector;
+}
+
+template<int Size, typename P1, typename B1, typename P2>
+inline DiagonalMatrix<Size, typename Internal::Divide::Return<P1,P2>::Type>
+operator/(const DiagonalMatrix<Size,P1,B1>& d, const P2& s){
+	return d.my_vector / s;
+}
+
+///Invert a diagonal matrix, which takes O(N) operations.
+///@relates DiagonalMatrix
+template<int Size, typename P, typename B>
+inline DiagonalMatrix<Size, typename Internal::DivideType<int, P>::type>
+inverse(const DiagonalMatrix<Size,P,B>& d){
+	DiagonalMatrix<Size, typename Internal::DivideType<int, P>::type> r(d.my_vector.size());
+	for(int i=0; i < d.my_vector.size(); i++)
+		r.my_vector[i] = 1 / d.my_vector[i];
+	return r;
+}
+
 }
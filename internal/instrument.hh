@@ -0,0 +1,211 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+// Performance instrumentation. See \ref sInstrument.
+//
+// When TOON_INSTRUMENT is not defined, all of the hooks expand to nothing and
+// their arguments are not evaluated, so there is no cost at all.
+
+#ifdef TOON_INSTRUMENT
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <ostream>
+#include <iomanip>
+#endif
+
+namespace TooN {
+
+#ifdef TOON_INSTRUMENT
+
+///Performance counters, available when TOON_INSTRUMENT is defined.
+///All counters are kept per thread.
+///@ingroup gInternal
+namespace Instrument
+{
+	///Counters for a single named operation, such as an operator
+	///or a decomposition.
+	struct Operation
+	{
+		unsigned long long calls;  ///< Number of times the operation was performed
+		double flops;              ///< Approximate number of floating point operations
+		double seconds;            ///< Time spent (only for timed operations)
+
+		Operation()
+		:calls(0), flops(0), seconds(0)
+		{}
+	};
+
+	///The counters for one thread.
+	struct Report
+	{
+		unsigned long long allocations;     ///< Number of heap allocations of Vector and Matrix data
+		unsigned long long bytes_allocated; ///< Total size of the heap allocations
+		unsigned long long copies;          ///< Number of Vector or Matrix copy constructions
+		unsigned long long bytes_copied;    ///< Bytes copied by copy constructors
+		std::map<std::string, Operation> operations; ///< Per operation counters
+
+		Report()
+		:allocations(0), bytes_allocated(0), copies(0), bytes_copied(0)
+		{}
+
+		///Total number of floating point operations over all operations.
+		double flops() const
+		{
+			double f=0;
+			for(std::map<std::string, Operation>::const_iterator i=operations.begin(); i != operations.end(); ++i)
+				f += i->second.flops;
+			return f;
+		}
+	};
+
+	///Return the counters for the calling thread.
+	inline Report& report()
+	{
+		static thread_local Report r;
+		return r;
+	}
+
+	///Set all counters for the calling thread to zero.
+	inline void reset()
+	{
+		Report& r = report();
+		r.allocations = r.bytes_allocated = r.copies = r.bytes_copied = 0;
+
+		//Entries are never removed since the instrumentation hooks
+		//hold references to them.
+		for(std::map<std::string, Operation>::iterator i=r.operations.begin(); i != r.operations.end(); ++i)
+			i->second = Operation();
+	}
+
+	///Print a report in a human readable form.
+	inline void print(std::ostream& o, const Report& r = report())
+	{
+		o << "allocations: " << r.allocations << " (" << r.bytes_allocated << " bytes)\n";
+		o << "copies: " << r.copies << " (" << r.bytes_copied << " bytes)\n";
+		o << "flops: " << r.flops() << "\n";
+
+		for(std::map<std::string, Operation>::const_iterator i=r.operations.begin(); i != r.operations.end(); ++i)
+			if(i->second.calls)
+			{
+				o << "  " << std::left << std::setw(32) << i->first << std::right
+				  << " calls: " << std::setw(10) << i->second.calls
+				  << " flops: " << std::setw(12) << i->second.flops;
+				if(i->second.seconds != 0)
+					o << " seconds: " << i->second.seconds;
+				o << "\n";
+			}
+	}
+}
+
+namespace Internal
+{
+	///@internal
+	///Find the counters for a named operation in the calling thread.
+	///@ingroup gInternal
+	inline Instrument::Operation& instrument_operation(const char* name)
+	{
+		return Instrument::report().operations[name];
+	}
+
+	///@internal
+	///@ingroup gInternal
+	inline void instrument_alloc(std::size_t bytes)
+	{
+		Instrument::Report& r = Instrument::report();
+		r.allocations++;
+		r.bytes_allocated += bytes;
+	}
+
+	///@internal
+	///@ingroup gInternal
+	inline void instrument_copy(std::size_t bytes)
+	{
+		Instrument::Report& r = Instrument::report();
+		r.copies++;
+		r.bytes_copied += bytes;
+	}
+
+	///@internal
+	///Accumulate the time between construction and destruction into an operation.
+	///@ingroup gInternal
+	class InstrumentTimer
+	{
+		public:
+			InstrumentTimer(Instrument::Operation& o)
+			:op(o), start(std::chrono::steady_clock::now())
+			{}
+
+			~InstrumentTimer()
+			{
+				op.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+
+		private:
+			Instrument::Operation& op;
+			std::chrono::steady_clock::time_point start;
+	};
+}
+
+	///@internal
+	///Record a heap allocation of the given number of bytes.
+	#define TOON_INSTRUMENT_ALLOC(bytes) ::TooN::Internal::instrument_alloc(bytes)
+
+	///@internal
+	///Record a copy construction of the given number of bytes.
+	#define TOON_INSTRUMENT_COPY(bytes) ::TooN::Internal::instrument_copy(bytes)
+
+	///@internal
+	///Record one call to the named operation, performing the given number of flops.
+	///The name must be a string literal.
+	#define TOON_INSTRUMENT_OPERATION(name, nflops) \
+		do{ \
+			static thread_local ::TooN::Instrument::Operation& toon_instrument_op = ::TooN::Internal::instrument_operation(name); \
+			toon_instrument_op.calls++; \
+			toon_instrument_op.flops += (nflops); \
+		}while(0)
+
+	///@internal
+	///As TOON_INSTRUMENT_OPERATION, but also time the remainder of the enclosing scope.
+	#define TOON_INSTRUMENT_TIMED_OPERATION(name, nflops) \
+		static thread_local ::TooN::Instrument::Operation& toon_instrument_timed_op = ::TooN::Internal::instrument_operation(name); \
+		toon_instrument_timed_op.calls++; \
+		toon_instrument_timed_op.flops += (nflops); \
+		::TooN::Internal::InstrumentTimer toon_instrument_timer(toon_instrument_timed_op)
+
+#else
+
+	#define TOON_INSTRUMENT_ALLOC(bytes) ((void)0)
+	#define TOON_INSTRUMENT_COPY(bytes) ((void)0)
+	#define TOON_INSTRUMENT_OPERATION(name, nflops) ((void)0)
+	#define TOON_INSTRUMENT_TIMED_OPERATION(name, nflops) ((void)0)
+
+#endif
+
+}
@@ -0,0 +1,127 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+namespace TooN {
+
+namespace Internal
+{
+
+///@internal
+///Random access iterator over the elements of a strided slice. The
+///stride is part of the type when it is known at compile time. The
+///position is held as an index from the start of the slice, so that
+///the end of a strided slice never points outside the underlying data.
+///@ingroup gInternal
+template<int Stride, class Pointer, class Reference> class StridedIterator
+{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef typename std::iterator_traits<Pointer>::value_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Pointer pointer;
+		typedef Reference reference;
+
+		StridedIterator()
+		:my_data(0), my_index(0), my_stride(Stride)
+		{}
+
+		StridedIterator(Pointer data, std::ptrdiff_t index, int stride)
+		:my_data(data), my_index(index), my_stride(stride)
+		{}
+
+		///Allow an iterator to be converted to a const_iterator.
+		template<class P, class R>
+		StridedIterator(const StridedIterator<Stride, P, R>& i)
+		:my_data(i.my_data), my_index(i.my_index), my_stride(i.my_stride)
+		{}
+
+		int stride() const
+		{
+			return Stride == Dynamic ? my_stride : Stride;
+		}
+
+		Reference operator*() const { return my_data[my_index * stride()]; }
+		Pointer operator->() const { return my_data + my_index * stride(); }
+		Reference operator[](difference_type n) const { return my_data[(my_index + n) * stride()]; }
+
+		StridedIterator& operator++() { ++my_index; return *this; }
+		StridedIterator& operator--() { --my_index; return *this; }
+		StridedIterator operator++(int) { StridedIterator i(*this); ++my_index; return i; }
+		StridedIterator operator--(int) { StridedIterator i(*this); --my_index; return i; }
+		StridedIterator& operator+=(difference_type n) { my_index += n; return *this; }
+		StridedIterator& operator-=(difference_type n) { my_index -= n; return *this; }
+
+		StridedIterator operator+(difference_type n) const { return StridedIterator(my_data, my_index + n, my_stride); }
+		StridedIterator operator-(difference_type n) const { return StridedIterator(my_data, my_index - n, my_stride); }
+		friend StridedIterator operator+(difference_type n, const StridedIterator& i) { return i + n; }
+
+		difference_type operator-(const StridedIterator& i) const { return my_index - i.my_index; }
+
+		bool operator==(const StridedIterator& i) const { return my_index == i.my_index; }
+		bool operator!=(const StridedIterator& i) const { return my_index != i.my_index; }
+		bool operator<(const StridedIterator& i) const { return my_index < i.my_index; }
+		bool operator>(const StridedIterator& i) const { return my_index > i.my_index; }
+		bool operator<=(const StridedIterator& i) const { return my_index <= i.my_index; }
+		bool operator>=(const StridedIterator& i) const { return my_index >= i.my_index; }
+
+	private:
+		template<int, class, class> friend class StridedIterator;
+
+		Pointer my_data;
+		std::ptrdiff_t my_index;
+		int my_stride;
+};
+
+///@internal
+///Select the iterator type for a vector with a given stride. Unit stride
+///vectors are iterated with plain pointers, which are contiguous
+///iterators, so that the standard algorithms can vectorize over them.
+///@ingroup gInternal
+template<int Stride, class Pointer, class Reference> struct IteratorType
+{
+	typedef StridedIterator<Stride, Pointer, Reference> type;
+
+	static type make(Pointer data, int index, int stride)
+	{
+		return type(data, index, stride);
+	}
+};
+
+template<class Pointer, class Reference> struct IteratorType<1, Pointer, Reference>
+{
+	typedef Pointer type;
+
+	static type make(Pointer data, int index, int)
+	{
+		return data + index;
+	}
+};
+
+}
+
+}
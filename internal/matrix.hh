@@ -141,6 +141,9 @@ public:
 
 	//See vector.hh and allocator.hh for details about why the
 	//copy constructor should be default.
+	Matrix(const Matrix&) = default;
+	Matrix(Matrix&&) noexcept = default;
+
 	///Construction from an operator.
 	template <class Op>
 	inline Matrix(const Operator<Op>& op)
@@ -149,6 +152,28 @@ public:
 		op.eval(*this);
 	}
 
+	///Construction from Data(). Small statically sized row major matrices
+	///are initialised directly from the elements, so this can be used in
+	///constant expressions.
+	template<int N, class P2>
+	constexpr Matrix(const Operator<Internal::Data<N, P2> >& d)
+		:Matrix(d, typename Internal::ElementInit<(Rows > 0 && Cols > 0) ? Rows*Cols : Dynamic, Precision, Internal::InOrderStorage<Layout>::value>::type())
+	{}
+
+	///@internal
+	template<int N, class P2>
+	constexpr Matrix(const Operator<Internal::Data<N, P2> >& d, Internal::Elements e)
+		:Layout::template MLayout<Rows,Cols,Precision>(e, d.vals)
+	{}
+
+	///@internal
+	template<int N, class P2>
+	inline Matrix(const Operator<Internal::Data<N, P2> >& d, Internal::EvalElements)
+		:Layout::template MLayout<Rows,Cols,Precision>(d)
+	{
+		d.eval(*this);
+	}
+
 	/// constructor from arbitrary matrix
 	template<int Rows2, int Cols2, typename Precision2, typename Base2>
 	inline Matrix(const Matrix<Rows2, Cols2,Precision2,Base2>& from)
@@ -163,6 +188,7 @@ public:
 	/// operator = from copy
 	inline Matrix& operator= (const Matrix& from)
 	{
+		this->reallocate_moved_from(from.num_rows(), from.num_cols());
 		SizeMismatch<Rows, Rows>::test(num_rows(), from.num_rows());
 		SizeMismatch<Cols, Cols>::test(num_cols(), from.num_cols());
 
@@ -173,9 +199,18 @@ public:
 	    return *this;
 	}
 
+	/// Move assignment. The data is taken from \e from without copying
+	/// if the matrix owns data on the heap, otherwise it is copied.
+	inline Matrix& operator= (Matrix&& from)
+	{
+		Internal::MoveAssign<Matrix>::assign(*this, from);
+		return *this;
+	}
+
 	// operator = 0-ary operator
 	template<class Op> inline Matrix& operator= (const Operator<Op>& op)
 	{
+		this->reallocate_moved_from(num_rows(), num_cols());
 		op.eval(*this);
 		return *this;
 	}
@@ -184,6 +219,7 @@ public:
 	template<int Rows2, int Cols2, typename Precision2, typename Base2>
 	Matrix& operator= (const Matrix<Rows2, Cols2, Precision2, Base2>& from)
 	{
+		this->reallocate_moved_from(from.num_rows(), from.num_cols());
 		SizeMismatch<Rows, Rows2>::test(num_rows(), from.num_rows());
 		SizeMismatch<Cols, Cols2>::test(num_cols(), from.num_cols());
 
@@ -506,6 +542,21 @@ public:
 		*/
 		Matrix<>& slice(int rstart, int cstart, int rsize, int csize);
 
+		/**
+		Extract a sub-matrix of static size at a runtime location. The matrix
+		extracted will begin at element (rstart, cstart) and will contain the
+		next Rsize by Csize elements. The size is part of the type, so
+		operations on the slice are unrolled.
+		@code
+		Matrix<> m(30,30);
+		m.slice<6,6>(i, i) += J.T() * J;
+		@endcode
+		@internal
+		This method is not defined by Matrix: it is inherited.
+		*/
+		template<Rsize, Csize>
+		Matrix<Rsize, Csize>& slice(int rstart, int cstart);
+
 		//@}
 
 
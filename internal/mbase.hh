@@ -87,7 +87,7 @@ template<int Rows, int Cols, class Precision, int RowStride, int ColStride, clas
 	
 	typedef Slice<SliceRowStride,SliceColStride> SliceBase;
 
-	int rowstride() const {
+	constexpr int rowstride() const {
 		if(RowStride == -2) { //Normal tied stride
 			return num_cols();
 		} else {
@@ -95,7 +95,7 @@ template<int Rows, int Cols, class Precision, int RowStride, int ColStride, clas
 		}
 	}
 
-	int colstride() const {
+	constexpr int colstride() const {
 		if(ColStride == -2) { //Normal tied stride
 			return num_rows();
 		} else {
@@ -127,17 +127,21 @@ template<int Rows, int Cols, class Precision, int RowStride, int ColStride, clas
 		  ColStrideHolder<ColStride>(op)
 	{}
 
+	template<int N, class P2>
+	constexpr GenericMBase(Elements e, const P2 (&vals)[N])
+	:Mem(e, vals) {}
+
 	using Mem::my_data;
 	using Mem::num_cols;
 	using Mem::num_rows;
 
-	Precision& operator()(int r, int c){
+	constexpr Precision& operator()(int r, int c){
 		Internal::check_index(num_rows(), r);
 		Internal::check_index(num_cols(), c);
 		return my_data[r*rowstride() + c*colstride()];
 	}
 
-	const Precision& operator()(int r, int c) const {
+	constexpr const Precision& operator()(int r, int c) const {
 		Internal::check_index(num_rows(), r);
 		Internal::check_index(num_cols(), c);
 		return my_data[r*rowstride() + c*colstride()];
@@ -217,6 +221,21 @@ template<int Rows, int Cols, class Precision, int RowStride, int ColStride, clas
 		return slice<Rstart, Cstart, Rlength, Clength>(Rstart, Cstart, Rlength, Clength);
 	}
 
+	//Half dynamic slices: static size at a run-time position
+	template<int Rlength, int Clength>
+	Matrix<Rlength, Clength, Precision, Slice<SliceRowStride,SliceColStride> > slice(int rs, int cs)
+	{
+		static_assert(Rlength != Dynamic && Clength != Dynamic, "slice<Rlength, Clength>(rs, cs) needs a static size");
+		return slice<Dynamic, Dynamic, Rlength, Clength>(rs, cs, Rlength, Clength);
+	}
+
+	template<int Rlength, int Clength>
+	const Matrix<Rlength, Clength, const Precision, Slice<SliceRowStride,SliceColStride> > slice(int rs, int cs) const
+	{
+		static_assert(Rlength != Dynamic && Clength != Dynamic, "slice<Rlength, Clength>(rs, cs) needs a static size");
+		return slice<Dynamic, Dynamic, Rlength, Clength>(rs, cs, Rlength, Clength);
+	}
+
 	Matrix<-1, -1, Precision, Slice<SliceRowStride,SliceColStride> > slice(int rs, int cs, int rl, int cl){
 		return slice<Dynamic, Dynamic, Dynamic, Dynamic>(rs, cs, rl, cl);
 	}
@@ -272,9 +291,22 @@ struct RowMajor
 			:Internal::GenericMBase<Rows, Cols, Precision, (Cols == -1 ? -2 : Cols), 1, Internal::MatrixAlloc<Rows, Cols, Precision> >(op)
 		{}
 
+		template<int N, class P2>
+		constexpr MLayout(Internal::Elements e, const P2 (&vals)[N])
+			:Internal::GenericMBase<Rows, Cols, Precision, (Cols == -1 ? -2 : Cols), 1, Internal::MatrixAlloc<Rows, Cols, Precision> >(e, vals)
+		{}
+
 	};
 };
 
+namespace Internal
+{
+	template<> struct InOrderStorage<RowMajor>
+	{
+		static const bool value = true;
+	};
+}
+
 struct ColMajor
 {
 	template<int Rows, int Cols, class Precision> struct MLayout: public Internal::GenericMBase<Rows, Cols, Precision, 1, (Rows==-1?-2:Rows), Internal::MatrixAlloc<Rows, Cols, Precision> >
@@ -0,0 +1,138 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+// Control of heap allocation. See \ref sNoHeap.
+//
+// Every heap allocation made for the data of a Vector or Matrix goes through
+// Internal::allocate or Internal::note_heap_allocation. This allows heap
+// allocation to be forbidden at compile time (TOON_NO_HEAP) or at run time
+// (NoAllocGuard), and counted (TOON_INSTRUMENT).
+
+namespace TooN {
+
+namespace Internal
+{
+	#ifndef TOON_NDEBUG_HEAP
+		///@internal
+		///Number of NoAllocGuard objects alive in the calling thread.
+		///@ingroup gInternal
+		inline int& no_alloc_depth()
+		{
+			static thread_local int depth=0;
+			return depth;
+		}
+
+		///@internal
+		///Fail if heap allocation is currently forbidden.
+		///@ingroup gInternal
+		inline void check_heap_allocation()
+		{
+			if(no_alloc_depth() != 0)
+			{
+				#ifdef TOON_TEST_INTERNALS
+					throw Internal::HeapAllocation();
+				#else
+					std::cerr << "TooN heap allocation inside NoAllocGuard" << std::endl;
+					std::abort();
+				#endif
+			}
+		}
+	#else
+		inline void check_heap_allocation(){}
+	#endif
+
+	///@internal
+	///Is heap allocation permitted at all? The answer depends on the type only
+	///so that the check is made when (and if) an allocating function is
+	///instantiated.
+	///@ingroup gInternal
+	template<class Precision> struct HeapAllowed
+	{
+		#ifdef TOON_NO_HEAP
+			static const bool value = false;
+		#else
+			static const bool value = true;
+		#endif
+	};
+
+	///@internal
+	///This must be called for every heap allocation of n elements.
+	///@ingroup gInternal
+	template<class Precision> inline void note_heap_allocation(int n)
+	{
+		static_assert(HeapAllowed<Precision>::value, "TOON_NO_HEAP is defined, but this Vector or Matrix stores its data on the heap.");
+		check_heap_allocation();
+		TOON_INSTRUMENT_ALLOC(sizeof(Precision)*n);
+		(void)n;
+	}
+
+	///@internal
+	///Allocate storage for n elements on the heap.
+	///@ingroup gInternal
+	template<class Precision> inline Precision* allocate(int n)
+	{
+		note_heap_allocation<Precision>(n);
+		return new Precision[n];
+	}
+}
+
+///Forbid heap allocation by TooN in the calling thread for the lifetime of
+///this object. Any Vector or Matrix which needs to allocate memory while a
+///guard exists is a fatal error. Guards may be nested. The check is removed
+///when \c TOON_NDEBUG or \c NDEBUG is defined. See \ref sNoHeap.
+///@code
+///	void control_step()
+///	{
+///		NoAllocGuard no_alloc;
+///		//Any allocation by TooN in here aborts.
+///		...
+///	}
+///@endcode
+///@ingroup gLinAlg
+class NoAllocGuard
+{
+	public:
+		#ifndef TOON_NDEBUG_HEAP
+			NoAllocGuard()
+			{
+				++Internal::no_alloc_depth();
+			}
+
+			~NoAllocGuard()
+			{
+				--Internal::no_alloc_depth();
+			}
+		#else
+			NoAllocGuard(){}
+		#endif
+
+		NoAllocGuard(const NoAllocGuard&) = delete;
+		NoAllocGuard& operator=(const NoAllocGuard&) = delete;
+};
+
+}
@@ -145,6 +145,7 @@ struct Operator<Internal::VPairwise<Op, S1, P1, B1, S2, P2, B2> > {
 	template<int S0, typename P0, typename Ba0>
 	void eval(Vector<S0, P0, Ba0>& res) const
 	{
+		TOON_INSTRUMENT_OPERATION("vector pairwise", res.size());
 		for(int i=0; i < res.size(); ++i)
 			res[i] = Op::template op<P0,P1, P2>(lhs[i],rhs[i]);
 	}
@@ -153,7 +154,7 @@ struct Operator<Internal::VPairwise<Op, S1, P1, B1, S2, P2, B2> > {
 
 // Addition Vector + Vector
 template<int S1, int S2, typename P1, typename P2, typename B1, typename B2> 
-Vector<Internal::Sizer<S1,S2>::size, typename Internal::AddType<P1, P2>::type> 
+Vector<Internal::Sizer<S1,S2>::size, typename Internal::AddType<P1, P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type> 
 operator+(const Vector<S1, P1, B1>& v1, const Vector<S2, P2, B2>& v2)
 {
 	SizeMismatch<S1, S2>:: test(v1.size(),v2.size());
@@ -162,7 +163,7 @@ operator+(const Vector<S1, P1, B1>& v1, const Vector<S2, P2, B2>& v2)
 
 // Subtraction Vector - Vector
 template<int S1, int S2, typename P1, typename P2, typename B1, typename B2> 
-Vector<Internal::Sizer<S1,S2>::size, typename Internal::SubtractType<P1, P2>::type> operator-(const Vector<S1, P1, B1>& v1, const Vector<S2, P2, B2>& v2)
+Vector<Internal::Sizer<S1,S2>::size, typename Internal::SubtractType<P1, P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type> operator-(const Vector<S1, P1, B1>& v1, const Vector<S2, P2, B2>& v2)
 {
 	SizeMismatch<S1, S2>:: test(v1.size(),v2.size());
 	return Operator<Internal::VPairwise<Internal::Subtract,S1,P1,B1,S2,P2,B2> >(v1,v2);
@@ -170,7 +171,7 @@ Vector<Internal::Sizer<S1,S2>::size, typename Internal::SubtractType<P1, P2>::ty
 
 // diagmult Vector, Vector
 template <int S1, int S2, typename P1, typename P2, typename B1, typename B2>
-Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type> diagmult(const Vector<S1,P1,B1>& v1, const Vector<S2,P2,B2>& v2)
+Vector<Internal::Sizer<S1,S2>::size, typename Internal::MultiplyType<P1,P2>::type, typename Internal::PairwiseVectorBase<Internal::Sizer<S1,S2>::size, B1, B2>::type> diagmult(const Vector<S1,P1,B1>& v1, const Vector<S2,P2,B2>& v2)
 {
 	SizeMismatch<S1,S2>::test(v1.size(),v2.size());
 	return Operator<Internal::VPairwise<Internal::Multiply,S1,P1,B1,S2,P2,B2> >(v1,v2);
@@ -191,7 +192,7 @@ struct Operator<Internal::VNegate<S, P, A> > {
 
 // Negation -Vector
 template <int S, typename P, typename A>
-Vector<S, P> operator-(const Vector<S,P,A> & v){
+Vector<S, P, typename Internal::VectorBase<S, A>::type> operator-(const Vector<S,P,A> & v){
 	return Operator<Internal::VNegate<S,P,A> >(v);
 }
 
@@ -254,6 +255,7 @@ struct Operator<Internal::MPairwise<Op, R1, C1, P1, B1, R2, C2, P2, B2> > {
 	template<int R0, int C0, typename P0, typename Ba0>
 	void eval(Matrix<R0, C0, P0, Ba0>& res) const
 	{
+		TOON_INSTRUMENT_OPERATION("matrix pairwise", res.num_rows()*res.num_cols());
 		for(int r=0; r < res.num_rows(); ++r){
 			for(int c=0; c < res.num_cols(); ++c){
 				res(r,c) = Op::template op<P0,P1, P2>(lhs(r,c),rhs(r,c));
@@ -266,7 +268,7 @@ struct Operator<Internal::MPairwise<Op, R1, C1, P1, B1, R2, C2, P2, B2> > {
 
 // Addition Matrix + Matrix
 template<int R1, int R2, int C1, int C2, typename P1, typename P2, typename B1, typename B2> 
-Matrix<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, typename Internal::AddType<P1, P2>::type> 
+Matrix<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, typename Internal::AddType<P1, P2>::type, typename Internal::PairwiseMatrixBase<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, B1, B2>::type> 
 operator+(const Matrix<R1, C1, P1, B1>& m1, const Matrix<R2, C2, P2, B2>& m2)
 {
 	SizeMismatch<R1, R2>:: test(m1.num_rows(),m2.num_rows());
@@ -276,7 +278,7 @@ operator+(const Matrix<R1, C1, P1, B1>& m1, const Matrix<R2, C2, P2, B2>& m2)
 
 // Subtraction Matrix - Matrix
 template<int R1, int R2, int C1, int C2, typename P1, typename P2, typename B1, typename B2> 
-Matrix<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, typename Internal::SubtractType<P1, P2>::type> 
+Matrix<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, typename Internal::SubtractType<P1, P2>::type, typename Internal::PairwiseMatrixBase<Internal::Sizer<R1,R2>::size, Internal::Sizer<C1,C2>::size, B1, B2>::type> 
 operator-(const Matrix<R1, C1, P1, B1>& m1, const Matrix<R2, C2, P2, B2>& m2)
 {
 	SizeMismatch<R1, R2>:: test(m1.num_rows(),m2.num_rows());
@@ -300,7 +302,7 @@ struct Operator<Internal::MNegate<R,C, P, A> > {
 
 // Negation -Matrix
 template <int R, int C, typename P, typename A>
-Matrix<R, C, P> operator-(const Matrix<R,C,P,A> & v){
+Matrix<R, C, P, typename Internal::MatrixBase<R, C, A>::type> operator-(const Matrix<R,C,P,A> & v){
 	return Operator<Internal::MNegate<R,C,P,A> >(v);
 }
 
@@ -315,6 +317,7 @@ struct Operator<Internal::MatrixMultiply<R1, C1, P1, B1, R2, C2, P2, B2> > {
 	template<int R0, int C0, typename P0, typename Ba0>
 	void eval(Matrix<R0, C0, P0, Ba0>& res) const
 	{
+		TOON_INSTRUMENT_OPERATION("matrix * matrix", 2.0*res.num_rows()*res.num_cols()*lhs.num_cols());
 
 		for(int r=0; r < res.num_rows(); ++r) {
 			for(int c=0; c < res.num_cols(); ++c) {
@@ -332,7 +335,7 @@ struct Operator<Internal::MatrixMultiply<R1, C1, P1, B1, R2, C2, P2, B2> > {
 // Matrix multiplication Matrix * Matrix
 
 template<int R1, int C1, int R2, int C2, typename P1, typename P2, typename B1, typename B2> 
-Matrix<R1, C2, typename Internal::MultiplyType<P1, P2>::type> operator*(const Matrix<R1, C1, P1, B1>& m1, const Matrix<R2, C2, P2, B2>& m2)
+Matrix<R1, C2, typename Internal::MultiplyType<P1, P2>::type, typename Internal::MatrixResultBase<R1, C2, Internal::MatrixCapacity<B1>::rows, Internal::MatrixCapacity<B2>::cols, Internal::CombinedStorage<B1, B2>::value>::type> operator*(const Matrix<R1, C1, P1, B1>& m1, const Matrix<R2, C2, P2, B2>& m2)
 {
 	SizeMismatch<C1, R2>:: test(m1.num_cols(),m2.num_rows());
 	return Operator<Internal::MatrixMultiply<R1,C1,P1,B1,R2,C2,P2,B2> >(m1,m2);
@@ -374,6 +377,7 @@ struct Operator<Internal::MatrixVectorMultiply<R,C,P1,B1,Size,P2,B2> > {
 
 	template<int Sout, typename Pout, typename Bout>
 	void eval(Vector<Sout, Pout, Bout>& res) const {
+		TOON_INSTRUMENT_OPERATION("matrix * vector", 2.0*lhs.num_rows()*lhs.num_cols());
 		for(int i=0; i < res.size(); ++i){
 			res[i] = lhs[i] * rhs;
 		}
@@ -381,7 +385,7 @@ struct Operator<Internal::MatrixVectorMultiply<R,C,P1,B1,Size,P2,B2> > {
 };
 
 template<int R, int C, int Size, typename P1, typename P2, typename B1, typename B2>
-Vector<R, typename Internal::MultiplyType<P1,P2>::type> operator*(const Matrix<R, C, P1, B1>& m, const Vector<Size, P2, B2>& v)
+Vector<R, typename Internal::MultiplyType<P1,P2>::type, typename Internal::VectorResultBase<R, Internal::MatrixCapacity<B1>::rows, Internal::CombinedStorage<B1, B2>::value>::type> operator*(const Matrix<R, C, P1, B1>& m, const Vector<Size, P2, B2>& v)
 {
 	SizeMismatch<C,Size>::test(m.num_cols(), v.size());
 	return Operator<Internal::MatrixVectorMultiply<R,C,P1,B1,Size,P2,B2> >(m,v);
@@ -399,6 +403,7 @@ struct Operator<Internal::VectorMatrixMultiply<Size,P1,B1,R,C,P2,B2> > {
 
 	template<int Sout, typename Pout, typename Bout>
 	void eval(Vector<Sout, Pout, Bout>& res) const {
+		TOON_INSTRUMENT_OPERATION("vector * matrix", 2.0*rhs.num_rows()*rhs.num_cols());
 		for(int i=0; i < res.size(); ++i){
 			res[i] = lhs * rhs.T()[i];
 		}
@@ -406,7 +411,7 @@ struct Operator<Internal::VectorMatrixMultiply<Size,P1,B1,R,C,P2,B2> > {
 };
 
 template<int R, int C, typename P1, typename B1, int Size, typename P2, typename B2> 
-Vector<C, typename Internal::MultiplyType<P1,P2>::type> operator*(const Vector<Size,P1,B1>& v,
+Vector<C, typename Internal::MultiplyType<P1,P2>::type, typename Internal::VectorResultBase<C, Internal::MatrixCapacity<B2>::cols, Internal::CombinedStorage<B1, B2>::value>::type> operator*(const Vector<Size,P1,B1>& v,
 																  const Matrix<R,C,P2,B2>& m)
 {
 	SizeMismatch<R,Size>::test(m.num_rows(), v.size());
@@ -437,7 +442,7 @@ struct Operator<Internal::MatrixVectorDiagMultiply<R,C,P1,B1,Size,P2,B2> > {
 };
 
 template<int R, int C, int Size, typename P1, typename P2, typename B1, typename B2>
-Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type> diagmult(const Matrix<R, C, P1, B1>& m, const Vector<Size, P2, B2>& v)
+Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type, typename Internal::MatrixBase<R, C, B1>::type> diagmult(const Matrix<R, C, P1, B1>& m, const Vector<Size, P2, B2>& v)
 {
 	SizeMismatch<C,Size>::test(m.num_cols(), v.size());
 	return Operator<Internal::MatrixVectorDiagMultiply<R,C,P1,B1,Size,P2,B2> >(m,v);
@@ -466,7 +471,7 @@ struct Operator<Internal::VectorMatrixDiagMultiply<Size,P1,B1,R,C,P2,B2> > {
 };
 
 template<int R, int C, typename P1, typename B1, int Size, typename P2, typename B2> 
-Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type> diagmult(const Vector<Size,P1,B1>& v,
+Matrix<R, C, typename Internal::MultiplyType<P1,P2>::type, typename Internal::MatrixBase<R, C, B2>::type> diagmult(const Vector<Size,P1,B1>& v,
 																 const Matrix<R,C,P2,B2>& m)
 {
 	SizeMismatch<R,Size>::test(m.num_rows(), v.size());
@@ -506,6 +511,7 @@ struct Operator<Internal::ApplyScalarV<Size,P1,B1,P2,Op> > {
 		
 	template<int S0, typename P0, typename Ba0>
 	void eval(Vector<S0,P0,Ba0>& v) const {
+		TOON_INSTRUMENT_OPERATION("vector scalar", v.size());
 		for(int i=0; i<v.size(); i++){
 			v[i]= Op::template op<P0,P1,P2> (lhs[i],rhs);
 		}
@@ -517,11 +523,11 @@ struct Operator<Internal::ApplyScalarV<Size,P1,B1,P2,Op> > {
 };
 
 template <int Size, typename P1, typename B1, typename P2>
-Vector<Size, typename Internal::Multiply::Return<P1,P2>::Type> operator*(const Vector<Size, P1, B1>& v, const P2& s){
+Vector<Size, typename Internal::Multiply::Return<P1,P2>::Type, typename Internal::VectorBase<Size, B1>::type> operator*(const Vector<Size, P1, B1>& v, const P2& s){
 	return Operator<Internal::ApplyScalarV<Size,P1,B1,P2,Internal::Multiply> > (v,s);
 }
 template <int Size, typename P1, typename B1, typename P2>
-Vector<Size, typename Internal::Divide::Return<P1,P2>::Type> operator/(const Vector<Size, P1, B1>& v, const P2& s){
+Vector<Size, typename Internal::Divide::Return<P1,P2>::Type, typename Internal::VectorBase<Size, B1>::type> operator/(const Vector<Size, P1, B1>& v, const P2& s){
 	return Operator<Internal::ApplyScalarV<Size,P1,B1,P2,Internal::Divide> > (v,s);
 }
 
@@ -534,6 +540,7 @@ struct Operator<Internal::ApplyScalarVL<Size,P1,B1,P2,Op> > {
 		
 	template<int S0, typename P0, typename Ba0>
 	void eval(Vector<S0,P0,Ba0>& v) const {
+		TOON_INSTRUMENT_OPERATION("vector scalar", v.size());
 		for(int i=0; i<v.size(); i++){
 			v[i]= Op::template op<P0,P2,P1> (lhs,rhs[i]);
 		}
@@ -544,7 +551,7 @@ struct Operator<Internal::ApplyScalarVL<Size,P1,B1,P2,Op> > {
 	}
 };
 template <int Size, typename P1, typename B1, typename P2>
-Vector<Size, typename Internal::Multiply::Return<P2,P1>::Type> operator*(const P2& s, const Vector<Size, P1, B1>& v){
+Vector<Size, typename Internal::Multiply::Return<P2,P1>::Type, typename Internal::VectorBase<Size, B1>::type> operator*(const P2& s, const Vector<Size, P1, B1>& v){
 	return Operator<Internal::ApplyScalarVL<Size,P1,B1,P2,Internal::Multiply> > (s,v);
 }
 // no left division
@@ -561,6 +568,7 @@ struct Operator<Internal::ApplyScalarM<R,C,P1,B1,P2,Op> > {
 		
 	template<int R0, int C0, typename P0, typename Ba0>
 	void eval(Matrix<R0,C0,P0,Ba0>& m) const {
+		TOON_INSTRUMENT_OPERATION("matrix scalar", m.num_rows()*m.num_cols());
 		for(int r=0; r<m.num_rows(); r++){
 			for(int c=0; c<m.num_cols(); c++){
 				m(r,c)= Op::template op<P0,P1,P2> (lhs(r,c),rhs);
@@ -577,11 +585,11 @@ struct Operator<Internal::ApplyScalarM<R,C,P1,B1,P2,Op> > {
 };
 
 template <int R, int C, typename P1, typename B1, typename P2>
-Matrix<R,C, typename Internal::Multiply::Return<P1,P2>::Type> operator*(const Matrix<R,C, P1, B1>& m, const P2& s){
+Matrix<R,C, typename Internal::Multiply::Return<P1,P2>::Type, typename Internal::MatrixBase<R, C, B1>::type> operator*(const Matrix<R,C, P1, B1>& m, const P2& s){
 	return Operator<Internal::ApplyScalarM<R,C,P1,B1,P2,Internal::Multiply> > (m,s);
 }
 template <int R, int C, typename P1, typename B1, typename P2>
-Matrix<R,C, typename Internal::Divide::Return<P1,P2>::Type> operator/(const Matrix<R,C, P1, B1>& m, const P2& s){
+Matrix<R,C, typename Internal::Divide::Return<P1,P2>::Type, typename Internal::MatrixBase<R, C, B1>::type> operator/(const Matrix<R,C, P1, B1>& m, const P2& s){
 	return Operator<Internal::ApplyScalarM<R,C,P1,B1,P2,Internal::Divide> > (m,s);
 }
 
@@ -594,6 +602,7 @@ struct Operator<Internal::ApplyScalarML<R,C,P1,B1,P2,Op> > {
 		
 	template<int R0, int C0, typename P0, typename Ba0>
 	void eval(Matrix<R0,C0,P0,Ba0>& m) const {
+		TOON_INSTRUMENT_OPERATION("matrix scalar", m.num_rows()*m.num_cols());
 		for(int r=0; r<m.num_rows(); r++){
 			for(int c=0; c<m.num_cols(); c++){
 				m(r,c)= Op::template op<P0,P1,P2> (lhs,rhs(r,c));
@@ -610,7 +619,7 @@ struct Operator<Internal::ApplyScalarML<R,C,P1,B1,P2,Op> > {
 };
 
 template <int R, int C, typename P1, typename B1, typename P2>
-Matrix<R,C, typename Internal::Multiply::Return<P2,P1>::Type> operator*(const P2& s, const Matrix<R,C, P1, B1>& m){
+Matrix<R,C, typename Internal::Multiply::Return<P2,P1>::Type, typename Internal::MatrixBase<R, C, B1>::type> operator*(const P2& s, const Matrix<R,C, P1, B1>& m){
 	return Operator<Internal::ApplyScalarML<R,C,P1,B1,P2,Internal::Multiply> > (s,m);
 }
 
@@ -619,22 +628,22 @@ Matrix<R,C, typename Internal::Multiply::Return<P2,P1>::Type> operator*(const P2
 // Addition of operators
 //
 template <int Size, typename P1, typename B1, typename Op>
-Vector<Size, typename Internal::Add::Return<P1,typename Operator<Op>::Precision>::Type> operator+(const Vector<Size, P1, B1>& v, const Operator<Op>& op){
+Vector<Size, typename Internal::Add::Return<P1,typename Operator<Op>::Precision>::Type, typename Internal::VectorBase<Size, B1>::type> operator+(const Vector<Size, P1, B1>& v, const Operator<Op>& op){
 	return op.add(v);
 }
 
 template <int Size, typename P1, typename B1, typename Op>
-Vector<Size, typename Internal::Add::Return<typename Operator<Op>::Precision, P1>::Type> operator+(const Operator<Op>& op, const Vector<Size, P1, B1>& v){
+Vector<Size, typename Internal::Add::Return<typename Operator<Op>::Precision, P1>::Type, typename Internal::VectorBase<Size, B1>::type> operator+(const Operator<Op>& op, const Vector<Size, P1, B1>& v){
 	return op.add(v);
 }
 
 template <int Rows, int Cols, typename P1, typename B1, typename Op>
-Matrix<Rows, Cols, typename Internal::Add::Return<P1,typename Operator<Op>::Precision>::Type> operator+(const Matrix<Rows, Cols, P1, B1>& m, const Operator<Op>& op){
+Matrix<Rows, Cols, typename Internal::Add::Return<P1,typename Operator<Op>::Precision>::Type, typename Internal::MatrixBase<Rows, Cols, B1>::type> operator+(const Matrix<Rows, Cols, P1, B1>& m, const Operator<Op>& op){
 	return op.add(m);
 }
 
 template <int Rows, int Cols, typename P1, typename B1, typename Op>
-Matrix<Rows, Cols, typename Internal::Add::Return<typename Operator<Op>::Precision,P1>::Type> operator+(const Operator<Op>& op, const Matrix<Rows, Cols, P1, B1>& m){
+Matrix<Rows, Cols, typename Internal::Add::Return<typename Operator<Op>::Precision,P1>::Type, typename Internal::MatrixBase<Rows, Cols, B1>::type> operator+(const Operator<Op>& op, const Matrix<Rows, Cols, P1, B1>& m){
 	return op.add(m);
 }
 
@@ -642,22 +651,22 @@ Matrix<Rows, Cols, typename Internal::Add::Return<typename Operator<Op>::Precisi
 
 
 template <int Size, typename P1, typename B1, typename Op>
-Vector<Size, typename Internal::Subtract::Return<P1,typename Operator<Op>::Precision>::Type> operator-(const Vector<Size, P1, B1>& v, const Operator<Op>& op){
+Vector<Size, typename Internal::Subtract::Return<P1,typename Operator<Op>::Precision>::Type, typename Internal::VectorBase<Size, B1>::type> operator-(const Vector<Size, P1, B1>& v, const Operator<Op>& op){
 	return op.rsubtract(v);
 }
 
 template <int Size, typename P1, typename B1, typename Op>
-Vector<Size, typename Internal::Subtract::Return<typename Operator<Op>::Precision, P1>::Type> operator-(const Operator<Op>& op, const Vector<Size, P1, B1>& v){
+Vector<Size, typename Internal::Subtract::Return<typename Operator<Op>::Precision, P1>::Type, typename Internal::VectorBase<Size, B1>::type> operator-(const Operator<Op>& op, const Vector<Size, P1, B1>& v){
 	return op.lsubtract(v);
 }
 
 template <int Rows, int Cols, typename P1, typename B1, typename Op>
-Matrix<Rows, Cols, typename Internal::Subtract::Return<P1,typename Operator<Op>::Precision>::Type> operator-(const Matrix<Rows, Cols, P1, B1>& m, const Operator<Op>& op){
+Matrix<Rows, Cols, typename Internal::Subtract::Return<P1,typename Operator<Op>::Precision>::Type, typename Internal::MatrixBase<Rows, Cols, B1>::type> operator-(const Matrix<Rows, Cols, P1, B1>& m, const Operator<Op>& op){
 	return op.rsubtract(m);
 }
 
 template <int Rows, int Cols, typename P1, typename B1, typename Op>
-Matrix<Rows, Cols, typename Internal::Subtract::Return<typename Operator<Op>::Precision,P1>::Type> operator-(const Operator<Op>& op, const Matrix<Rows, Cols, P1, B1>& m){
+Matrix<Rows, Cols, typename Internal::Subtract::Return<typename Operator<Op>::Precision,P1>::Type, typename Internal::MatrixBase<Rows, Cols, B1>::type> operator-(const Operator<Op>& op, const Matrix<Rows, Cols, P1, B1>& m){
 	return op.lsubtract(m);
 }
 ////////////////////////////////////////////////////////////////////////////////
@@ -717,14 +726,13 @@ std::istream& operator >> (std::istream& is, Matrix<Rows, Cols, Precision, Base>
 //Overloads of swap
 namespace Internal
 {
-	TOON_CREATE_METHOD_DETECTOR(swap);
 	template<class V1, class V2, bool has_swap = Has_swap_Method<V1>::Has>
 	struct Swap
 	{
 		static void swap(V1& v1, V2& v2)
 		{
 			using std::swap;
-			SizeMismatch<V1::SizeParameter,V2::SizeParameter>::test(v1.size(), v2.size());
+			::TooN::SizeMismatch<V1::SizeParameter,V2::SizeParameter>::test(v1.size(), v2.size());
 			for(int i=0; i < v1.size(); i++)
 				swap(v1[i], v2[i]);
 		}
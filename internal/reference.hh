@@ -108,4 +108,45 @@ template<int Rows, int Cols, class Precision> inline const Matrix<Rows, Cols,
 template<class Precision>                     inline       Matrix<Dynamic, Dynamic, Precision,       Reference::RowMajor> wrapMatrix(Precision* data, int rows, int cols)       { return Matrix<Dynamic, Dynamic, Precision,       Reference::RowMajor>(data, rows, cols);}
 template<class Precision>                     inline const Matrix<Dynamic, Dynamic, const Precision, Reference::RowMajor> wrapMatrix(const Precision* data, int rows, int cols) { return Matrix<Dynamic, Dynamic, const Precision, Reference::RowMajor>(data, rows, cols);}
 ///@}
+
+///Wrap external data with arbitrary strides as a \link TooN::Vector Vector \endlink.
+///Element \e i is <code>data[i*stride]</code>. The result is a slice, so it can be
+///used anywhere that a slice of a Vector can be used, and the data is never
+///copied. As usual, the run-time size is only used if the template size is Dynamic.
+///@code
+///	//x, y, z, intensity
+///	float points[4*N];
+///	wrapVector(points + 3, N, 4);         //All of the intensities
+///@endcode
+///@ingroup gLinAlg
+///@{
+template<class Precision>           inline       Vector<Dynamic, Precision,       Internal::SliceVBase<Dynamic> > wrapVector(Precision* data, int size, int stride)       { return Vector<Dynamic, Precision,       Internal::SliceVBase<Dynamic> >(data, size, stride, Internal::Slicing()); }
+template<class Precision>           inline const Vector<Dynamic, const Precision, Internal::SliceVBase<Dynamic> > wrapVector(const Precision* data, int size, int stride) { return Vector<Dynamic, const Precision, Internal::SliceVBase<Dynamic> >(data, size, stride, Internal::Slicing()); }
+template<int Size, class Precision> inline       Vector<Size,    Precision,       Internal::SliceVBase<Dynamic> > wrapVector(Precision* data, int size, int stride)       { return Vector<Size,    Precision,       Internal::SliceVBase<Dynamic> >(data, size, stride, Internal::Slicing()); }
+template<int Size, class Precision> inline const Vector<Size,    const Precision, Internal::SliceVBase<Dynamic> > wrapVector(const Precision* data, int size, int stride) { return Vector<Size,    const Precision, Internal::SliceVBase<Dynamic> >(data, size, stride, Internal::Slicing()); }
+///@}
+
+///Wrap external data with arbitrary strides as a \link TooN::Matrix Matrix \endlink.
+///Element (\e r, \e c) is <code>data[r*rowstride + c*colstride]</code>, so this
+///covers padded rows, submatrices of larger buffers (such as images) and
+///interleaved data. The result is a slice, so it can be used anywhere that a
+///slice of a Matrix can be used, including the decompositions, and the data
+///is never copied. As usual, the run-time sizes are only used if the template
+///sizes are Dynamic.
+///@code
+///	//A 480x640 image with rows padded to 704 pixels
+///	float image[480*704];
+///	wrapMatrix(image + 704*100 + 200, 32, 32, 704, 1);  //A 32x32 window at (100, 200)
+///
+///	//x, y, z, intensity
+///	float points[4*N];
+///	wrapMatrix<Dynamic, 3>(points, N, 3, 4, 1);          //The N 3D points, one per row
+///@endcode
+///@ingroup gLinAlg
+///@{
+template<class Precision>                     inline       Matrix<Dynamic, Dynamic, Precision,       Internal::Slice<Dynamic, Dynamic> > wrapMatrix(Precision* data, int rows, int cols, int rowstride, int colstride)       { return Matrix<Dynamic, Dynamic, Precision,       Internal::Slice<Dynamic, Dynamic> >(data, rows, cols, rowstride, colstride, Internal::Slicing());}
+template<class Precision>                     inline const Matrix<Dynamic, Dynamic, const Precision, Internal::Slice<Dynamic, Dynamic> > wrapMatrix(const Precision* data, int rows, int cols, int rowstride, int colstride) { return Matrix<Dynamic, Dynamic, const Precision, Internal::Slice<Dynamic, Dynamic> >(data, rows, cols, rowstride, colstride, Internal::Slicing());}
+template<int Rows, int Cols, class Precision> inline       Matrix<Rows, Cols,       Precision,       Internal::Slice<Dynamic, Dynamic> > wrapMatrix(Precision* data, int rows, int cols, int rowstride, int colstride)       { return Matrix<Rows, Cols,       Precision,       Internal::Slice<Dynamic, Dynamic> >(data, rows, cols, rowstride, colstride, Internal::Slicing());}
+template<int Rows, int Cols, class Precision> inline const Matrix<Rows, Cols,       const Precision, Internal::Slice<Dynamic, Dynamic> > wrapMatrix(const Precision* data, int rows, int cols, int rowstride, int colstride) { return Matrix<Rows, Cols,       const Precision, Internal::Slice<Dynamic, Dynamic> >(data, rows, cols, rowstride, colstride, Internal::Slicing());}
+///@}
 }
@@ -0,0 +1,118 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+namespace TooN {
+
+namespace Internal
+{
+	///@internal
+	///@brief Storage policy for statically sized vectors and (row major)
+	///matrices with the placement of the data fixed, regardless of
+	///max_bytes_on_stack. Use the Stack and Heap typedefs.
+	///@ingroup gInternal
+	template<int Storage> struct PlacedStorage
+	{
+		template<int Size, typename Precision>
+		struct VLayout
+			: public GenericVBase<Size, Precision, 1, VectorAlloc<Size, Precision, Storage> >
+		{
+			static_assert(Size >= 0, "The Stack and Heap storage policies need a static size");
+
+			VLayout(){}
+
+			VLayout(int s)
+				:GenericVBase<Size, Precision, 1, VectorAlloc<Size, Precision, Storage> >(s)
+			{}
+
+			template<class Op>
+			VLayout(const Operator<Op>& op)
+				:GenericVBase<Size, Precision, 1, VectorAlloc<Size, Precision, Storage> >(op) {}
+		};
+
+		template<int Rows, int Cols, class Precision>
+		struct MLayout
+			: public GenericMBase<Rows, Cols, Precision, Cols, 1, MatrixAlloc<Rows, Cols, Precision, true, Storage> >
+		{
+			static_assert(Rows >= 0 && Cols >= 0, "The Stack and Heap storage policies need a static size");
+
+			MLayout(){}
+
+			MLayout(int rows, int cols)
+				:GenericMBase<Rows, Cols, Precision, Cols, 1, MatrixAlloc<Rows, Cols, Precision, true, Storage> >(rows, cols)
+			{}
+
+			template<class Op>
+			MLayout(const Operator<Op>& op)
+				:GenericMBase<Rows, Cols, Precision, Cols, 1, MatrixAlloc<Rows, Cols, Precision, true, Storage> >(op)
+			{}
+		};
+	};
+
+	///@internal
+	///Placement of the data of a statically sized object with the given
+	///storage policy (or layout).
+	///@ingroup gInternal
+	template<class Base> struct StorageOf
+	{
+		static const int value = AutoStorage;
+	};
+
+	template<int Storage> struct StorageOf<PlacedStorage<Storage> >
+	{
+		static const int value = Storage;
+	};
+
+	///@internal
+	///Placement of the result of an operation on two objects. The result
+	///is kept on the stack if either argument explicitly is.
+	///@ingroup gInternal
+	template<class B1, class B2> struct CombinedStorage
+	{
+		static const int value = (StorageOf<B1>::value == StackStorage || StorageOf<B2>::value == StackStorage) ? StackStorage : AutoStorage;
+	};
+}
+
+///Storage policy which keeps the data of a statically sized Vector or Matrix
+///on the stack, however large it is. Matrices are row major. The results of
+///operators on these objects are stored on the stack too, e.g.
+///@code
+///	Matrix<12, 12, double, Stack> P, F;
+///	P = F * P * F.T() + Q; //No heap allocation
+///@endcode
+///See \ref sNoHeap.
+///@ingroup gLinAlg
+typedef Internal::PlacedStorage<Internal::StackStorage> Stack;
+
+///Storage policy which keeps the data of a statically sized Vector or Matrix
+///on the heap, however small it is. Matrices are row major. This can be
+///used to make large objects cheap to swap, or to keep them off a small stack
+///when \c TOON_NO_HEAP_SPILL is defined. See \ref sNoHeap.
+///@ingroup gLinAlg
+typedef Internal::PlacedStorage<Internal::HeapStorage> Heap;
+
+}
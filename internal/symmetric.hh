@@ -0,0 +1,514 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+namespace TooN {
+
+namespace Internal
+{
+	///@internal
+	///Number of elements in the packed upper triangle of a Size x Size matrix.
+	///@ingroup gInternal
+	template<int Size> struct PackedSize
+	{
+		static const int size = Size == Dynamic ? Dynamic : Size*(Size+1)/2;
+	};
+}
+
+/**
+@class SymmetricMatrix
+A symmetric matrix, stored as its packed upper triangle, so it uses a little
+over half the memory of a Matrix of the same size.
+
+The upper triangle is stored row by row, so element (r, c) with r <= c is
+element <code>r*(2*N-r-1)/2 + c</code> of packed(). Indexing with (r, c) or
+(c, r) gives the same element.
+
+Symmetric matrices can be multiplied by vectors and matrices on either side,
+added and subtracted, and passed directly to Cholesky and SymEigen. They can be
+built from products of the form \f$J^\mathsf{T}WJ\f$ without computing the lower
+triangle:
+@code
+SymmetricMatrix<6> A = Zeros;
+A.add_JtJ(J);                //A += J^T J
+A.add_JtWJ(J2, W);           //A += J2^T W J2, with W symmetric or diagonal
+A.add_outer(j, w);           //A += w j j^T
+Cholesky<6> chol(A);
+@endcode
+@ingroup gLinAlg
+**/
+template<int Size=Dynamic, class Precision=DefaultPrecision>
+class SymmetricMatrix
+{
+	public:
+		///@name Construction
+		///@{
+
+		///Construct an uninitialized matrix (static sizes only).
+		SymmetricMatrix()
+		:my_size(Size), my_packed()
+		{
+			static_assert(Size != Dynamic, "A dynamic SymmetricMatrix needs a size");
+		}
+
+		///Construct an uninitialized matrix with the given size.
+		explicit SymmetricMatrix(int size)
+		:my_size(size), my_packed(packed_size(size))
+		{
+			SizeMismatch<Size, Size>::test(Size==Dynamic?size:Size, size);
+		}
+
+		///Construct from the upper triangle of a square matrix. The lower
+		///triangle is ignored.
+		template<int R, int C, class P, class B>
+		SymmetricMatrix(const Matrix<R, C, P, B>& m)
+		:my_size(m.num_rows()), my_packed(packed_size(m.num_rows()))
+		{
+			SizeMismatch<R, C>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Size, R>::test(size(), m.num_rows());
+			Precision* p = packed_data();
+			for(int r=0; r < size(); r++)
+				for(int c=r; c < size(); c++)
+					*p++ = m(r,c);
+		}
+
+		///Construct a zero matrix: <code>SymmetricMatrix<3> A = Zeros;</code>
+		SymmetricMatrix(const Operator<Internal::Zero>&)
+		:my_size(Size), my_packed(Zeros)
+		{
+			static_assert(Size != Dynamic, "Use Zeros(size) for a dynamic SymmetricMatrix");
+		}
+
+		///Construct a zero matrix: <code>SymmetricMatrix<> A = Zeros(3);</code>
+		SymmetricMatrix(const Operator<Internal::SizedZero>& op)
+		:my_size(op.size()), my_packed(packed_size(op.size()))
+		{
+			my_packed = Zeros;
+		}
+
+		///Construct a multiple of the identity: <code>SymmetricMatrix<3> A = Identity;</code>
+		template<class P>
+		SymmetricMatrix(const Operator<Internal::Identity<P> >& op)
+		:my_size(Size), my_packed()
+		{
+			static_assert(Size != Dynamic, "Use Identity(size) for a dynamic SymmetricMatrix");
+			*this = op;
+		}
+
+		///Construct a multiple of the identity: <code>SymmetricMatrix<> A = Identity(3);</code>
+		template<class P>
+		SymmetricMatrix(const Operator<Internal::SizedIdentity<P> >& op)
+		:my_size(op.num_rows()), my_packed(packed_size(op.num_rows()))
+		{
+			*this = op;
+		}
+		///@}
+
+		///@name Assignment
+		///@{
+
+		///Set all elements to zero.
+		SymmetricMatrix& operator=(const Operator<Internal::Zero>&)
+		{
+			my_packed = Zeros;
+			return *this;
+		}
+
+		///Set the matrix to a multiple of the identity.
+		template<class P>
+		SymmetricMatrix& operator=(const Operator<Internal::Identity<P> >& op)
+		{
+			my_packed = Zeros;
+			for(int i=0; i < size(); i++)
+				(*this)(i,i) = op.val;
+			return *this;
+		}
+		///@}
+
+		///@name Access
+		///@{
+
+		///The number of rows (and columns).
+		int size() const
+		{
+			return Size == Dynamic ? my_size : Size;
+		}
+
+		///The number of rows.
+		int num_rows() const
+		{
+			return size();
+		}
+
+		///The number of columns.
+		int num_cols() const
+		{
+			return size();
+		}
+
+		///Access an element. (r, c) and (c, r) refer to the same element.
+		Precision& operator()(int r, int c)
+		{
+			return my_packed[index(r, c)];
+		}
+
+		///Access an element. (r, c) and (c, r) refer to the same element.
+		const Precision& operator()(int r, int c) const
+		{
+			return my_packed[index(r, c)];
+		}
+
+		///The packed upper triangle, in row major order.
+		Vector<Internal::PackedSize<Size>::size, Precision>& packed()
+		{
+			return my_packed;
+		}
+
+		///The packed upper triangle, in row major order.
+		const Vector<Internal::PackedSize<Size>::size, Precision>& packed() const
+		{
+			return my_packed;
+		}
+
+		///Expand the matrix to a full matrix.
+		Matrix<Size, Size, Precision> dense() const
+		{
+			Matrix<Size, Size, Precision> m(size(), size());
+			const Precision* p = packed_data();
+			for(int r=0; r < size(); r++)
+				for(int c=r; c < size(); c++, p++)
+					m(r,c) = m(c,r) = *p;
+			return m;
+		}
+
+		///Write the matrix in to the lower triangle of a full matrix, which
+		///is all that Cholesky needs. The upper triangle is not written.
+		template<int R, int C, class P, class B> void copy_lower(Matrix<R, C, P, B>& m) const
+		{
+			SizeMismatch<Size, R>::test(size(), m.num_rows());
+			SizeMismatch<Size, C>::test(size(), m.num_cols());
+			const Precision* p = packed_data();
+			for(int r=0; r < size(); r++)
+				for(int c=r; c < size(); c++, p++)
+					m(c,r) = *p;
+		}
+		///@}
+
+		///@name Arithmetic
+		///@{
+
+		///Add another symmetric matrix.
+		template<class P>
+		SymmetricMatrix& operator+=(const SymmetricMatrix<Size, P>& m)
+		{
+			my_packed += m.packed();
+			return *this;
+		}
+
+		///Subtract another symmetric matrix.
+		template<class P>
+		SymmetricMatrix& operator-=(const SymmetricMatrix<Size, P>& m)
+		{
+			my_packed -= m.packed();
+			return *this;
+		}
+
+		///Multiply by a scalar.
+		SymmetricMatrix& operator*=(const Precision& s)
+		{
+			my_packed *= s;
+			return *this;
+		}
+
+		///Divide by a scalar.
+		SymmetricMatrix& operator/=(const Precision& s)
+		{
+			my_packed /= s;
+			return *this;
+		}
+
+		///Add \f$w\mathbf{v}\mathbf{v}^\mathsf{T}\f$ (a symmetric rank 1 update).
+		template<int S, class P, class B>
+		void add_outer(const Vector<S, P, B>& v, const Precision& w = 1)
+		{
+			SizeMismatch<Size, S>::test(size(), v.size());
+			TOON_INSTRUMENT_OPERATION("symmetric rank 1", (double)size()*(size()+1));
+			Precision* p = packed_data();
+			for(int r=0; r < size(); r++)
+			{
+				const Precision wv = w * v[r];
+				for(int c=r; c < size(); c++)
+					*p++ += wv * v[c];
+			}
+		}
+
+		///Add \f$J^\mathsf{T}J\f$ (a symmetric rank k update).
+		template<int R, int C, class P, class B>
+		void add_JtJ(const Matrix<R, C, P, B>& J)
+		{
+			SizeMismatch<Size, C>::test(size(), J.num_cols());
+			TOON_INSTRUMENT_OPERATION("symmetric rank k", (double)J.num_rows()*size()*(size()+1));
+			for(int k=0; k < J.num_rows(); k++)
+			{
+				Precision* p = packed_data();
+				for(int r=0; r < size(); r++)
+				{
+					const Precision j = J(k, r);
+					for(int c=r; c < size(); c++)
+						*p++ += j * J(k, c);
+				}
+			}
+		}
+
+		///Add \f$J^\mathsf{T}WJ\f$ where W is diagonal.
+		template<int R, int C, class P, class B, int S, class PW, class BW>
+		void add_JtWJ(const Matrix<R, C, P, B>& J, const DiagonalMatrix<S, PW, BW>& W)
+		{
+			SizeMismatch<Size, C>::test(size(), J.num_cols());
+			SizeMismatch<R, S>::test(J.num_rows(), W.my_vector.size());
+			TOON_INSTRUMENT_OPERATION("symmetric rank k", (double)J.num_rows()*size()*(size()+1));
+			for(int k=0; k < J.num_rows(); k++)
+			{
+				Precision* p = packed_data();
+				for(int r=0; r < size(); r++)
+				{
+					const Precision j = W[k] * J(k, r);
+					for(int c=r; c < size(); c++)
+						*p++ += j * J(k, c);
+				}
+			}
+		}
+
+		///Add \f$J^\mathsf{T}WJ\f$ where W is symmetric.
+		template<int R, int C, class P, class B, int S, class PW>
+		void add_JtWJ(const Matrix<R, C, P, B>& J, const SymmetricMatrix<S, PW>& W)
+		{
+			SizeMismatch<Size, C>::test(size(), J.num_cols());
+			SizeMismatch<R, S>::test(J.num_rows(), W.size());
+
+			//WJ is only needed once, so compute it first.
+			const Matrix<R, C, Precision> WJ = W * J;
+			TOON_INSTRUMENT_OPERATION("symmetric rank k", (double)J.num_rows()*size()*(size()+1));
+			for(int k=0; k < J.num_rows(); k++)
+			{
+				Precision* p = packed_data();
+				for(int r=0; r < size(); r++)
+				{
+					const Precision j = J(k, r);
+					for(int c=r; c < size(); c++)
+						*p++ += j * WJ(k, c);
+				}
+			}
+		}
+		///@}
+
+		///@internal
+		///Index of (r, c) in the packed storage.
+		int index(int r, int c) const
+		{
+			Internal::check_index(size(), r);
+			Internal::check_index(size(), c);
+			if(r > c)
+				std::swap(r, c);
+			return r*(2*size() - r - 1)/2 + c;
+		}
+
+	private:
+		static int packed_size(int n)
+		{
+			return n*(n+1)/2;
+		}
+
+		Precision* packed_data()
+		{
+			return size() ? &my_packed[0] : 0;
+		}
+
+		const Precision* packed_data() const
+		{
+			return size() ? &my_packed[0] : 0;
+		}
+
+		int my_size;
+		Vector<Internal::PackedSize<Size>::size, Precision> my_packed;
+};
+
+///Compute \f$J^\mathsf{T}J\f$ as a symmetric matrix.
+///@relates SymmetricMatrix
+template<int R, int C, class P, class B>
+SymmetricMatrix<C, P> JtJ(const Matrix<R, C, P, B>& J)
+{
+	SymmetricMatrix<C, P> s = Zeros(J.num_cols());
+	s.add_JtJ(J);
+	return s;
+}
+
+///Compute \f$J^\mathsf{T}WJ\f$ as a symmetric matrix, where W is symmetric.
+///@relates SymmetricMatrix
+template<int R, int C, class P, class B, int S, class PW>
+SymmetricMatrix<C, P> JtWJ(const Matrix<R, C, P, B>& J, const SymmetricMatrix<S, PW>& W)
+{
+	SymmetricMatrix<C, P> s = Zeros(J.num_cols());
+	s.add_JtWJ(J, W);
+	return s;
+}
+
+///Compute \f$J^\mathsf{T}WJ\f$ as a symmetric matrix, where W is diagonal.
+///@relates SymmetricMatrix
+template<int R, int C, class P, class B, int S, class PW, class BW>
+SymmetricMatrix<C, P> JtWJ(const Matrix<R, C, P, B>& J, const DiagonalMatrix<S, PW, BW>& W)
+{
+	SymmetricMatrix<C, P> s = Zeros(J.num_cols());
+	s.add_JtWJ(J, W);
+	return s;
+}
+
+///Multiply a symmetric matrix by a vector, using each stored element once.
+///@relates SymmetricMatrix
+template<int S1, class P1, int S2, class P2, class B2>
+Vector<S1, typename Internal::MultiplyType<P1, P2>::type> operator*(const SymmetricMatrix<S1, P1>& m, const Vector<S2, P2, B2>& v)
+{
+	SizeMismatch<S1, S2>::test(m.size(), v.size());
+	TOON_INSTRUMENT_OPERATION("symmetric * vector", 2.0*m.size()*m.size());
+	const int n = m.size();
+	Vector<S1, typename Internal::MultiplyType<P1, P2>::type> r = Zeros(n);
+	const P1* p = n ? &m.packed()[0] : 0;
+	for(int i=0; i < n; i++)
+	{
+		r[i] += *p++ * v[i];
+		for(int j=i+1; j < n; j++, p++)
+		{
+			r[i] += *p * v[j];
+			r[j] += *p * v[i];
+		}
+	}
+	return r;
+}
+
+///Multiply a vector by a symmetric matrix.
+///@relates SymmetricMatrix
+template<int S1, class P1, class B1, int S2, class P2>
+Vector<S2, typename Internal::MultiplyType<P1, P2>::type> operator*(const Vector<S1, P1, B1>& v, const SymmetricMatrix<S2, P2>& m)
+{
+	return m * v;
+}
+
+///Multiply a symmetric matrix by a matrix.
+///@relates SymmetricMatrix
+template<int S, class P1, int R, int C, class P2, class B2>
+Matrix<S, C, typename Internal::MultiplyType<P1, P2>::type> operator*(const SymmetricMatrix<S, P1>& m, const Matrix<R, C, P2, B2>& b)
+{
+	SizeMismatch<S, R>::test(m.size(), b.num_rows());
+	TOON_INSTRUMENT_OPERATION("symmetric * matrix", 2.0*m.size()*m.size()*b.num_cols());
+	const int n = m.size();
+	Matrix<S, C, typename Internal::MultiplyType<P1, P2>::type> r = Zeros(n, b.num_cols());
+	const P1* p = n ? &m.packed()[0] : 0;
+	for(int i=0; i < n; i++)
+	{
+		for(int k=0; k < b.num_cols(); k++)
+			r(i,k) += *p * b(i,k);
+		p++;
+
+		for(int j=i+1; j < n; j++, p++)
+			for(int k=0; k < b.num_cols(); k++)
+			{
+				r(i,k) += *p * b(j,k);
+				r(j,k) += *p * b(i,k);
+			}
+	}
+	return r;
+}
+
+///Multiply a matrix by a symmetric matrix.
+///@relates SymmetricMatrix
+template<int R, int C, class P1, class B1, int S, class P2>
+Matrix<R, S, typename Internal::MultiplyType<P1, P2>::type> operator*(const Matrix<R, C, P1, B1>& b, const SymmetricMatrix<S, P2>& m)
+{
+	SizeMismatch<C, S>::test(b.num_cols(), m.size());
+	TOON_INSTRUMENT_OPERATION("matrix * symmetric", 2.0*m.size()*m.size()*b.num_rows());
+	const int n = m.size();
+	Matrix<R, S, typename Internal::MultiplyType<P1, P2>::type> r = Zeros(b.num_rows(), n);
+	const P2* p = n ? &m.packed()[0] : 0;
+	for(int i=0; i < n; i++)
+	{
+		for(int k=0; k < b.num_rows(); k++)
+			r(k,i) += b(k,i) * *p;
+		p++;
+
+		for(int j=i+1; j < n; j++, p++)
+			for(int k=0; k < b.num_rows(); k++)
+			{
+				r(k,j) += b(k,i) * *p;
+				r(k,i) += b(k,j) * *p;
+			}
+	}
+	return r;
+}
+
+///Add two symmetric matrices.
+///@relates SymmetricMatrix
+template<int S1, class P1, int S2, class P2>
+SymmetricMatrix<Internal::Sizer<S1, S2>::size, typename Internal::AddType<P1, P2>::type> operator+(const SymmetricMatrix<S1, P1>& a, const SymmetricMatrix<S2, P2>& b)
+{
+	SizeMismatch<S1, S2>::test(a.size(), b.size());
+	SymmetricMatrix<Internal::Sizer<S1, S2>::size, typename Internal::AddType<P1, P2>::type> r(a.size());
+	r.packed() = a.packed() + b.packed();
+	return r;
+}
+
+///Subtract two symmetric matrices.
+///@relates SymmetricMatrix
+template<int S1, class P1, int S2, class P2>
+SymmetricMatrix<Internal::Sizer<S1, S2>::size, typename Internal::SubtractType<P1, P2>::type> operator-(const SymmetricMatrix<S1, P1>& a, const SymmetricMatrix<S2, P2>& b)
+{
+	SizeMismatch<S1, S2>::test(a.size(), b.size());
+	SymmetricMatrix<Internal::Sizer<S1, S2>::size, typename Internal::SubtractType<P1, P2>::type> r(a.size());
+	r.packed() = a.packed() - b.packed();
+	return r;
+}
+
+///Write a symmetric matrix to a stream, in the same form as a Matrix.
+///@relates SymmetricMatrix
+template<int S, class P>
+std::ostream& operator<<(std::ostream& os, const SymmetricMatrix<S, P>& m)
+{
+	std::streamsize fw = os.width();
+	for(int r=0; r < m.size(); r++)
+	{
+		for(int c=0; c < m.size(); c++)
+		{
+			if(c != 0)
+				os << " ";
+			os.width(fw);
+			os << m(r,c);
+		}
+		os << std::endl;
+	}
+	return os;
+}
+
+}
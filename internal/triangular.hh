@@ -0,0 +1,320 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+namespace TooN {
+
+namespace Internal
+{
+	///@internal
+	///The slice type of the transpose of a slice.
+	///@ingroup gInternal
+	template<class Base> struct TransposedSlice;
+
+	template<int RowStride, int ColStride> struct TransposedSlice<Slice<RowStride, ColStride> >
+	{
+		typedef Slice<ColStride, RowStride> type;
+	};
+}
+
+/**
+@class TriangularMatrix
+A read-only view of the upper or lower triangle of an existing square matrix.
+No data is copied: the view refers to the storage of the matrix it was made
+from, and elements outside the triangle are treated as zero whatever their
+value. If \c Unit is true, the diagonal is treated as all ones and is never
+read, which matches the packed L factor produced by LU.
+
+Multiplying by a triangular view and solving with one only touch the elements
+of the triangle, so they take half of the work of the dense equivalents:
+@code
+Cholesky<6> chol(C);
+Matrix<6> L = chol.get_L();
+
+Vector<6> w = solve(lower_triangular(L), v);   //w = L^-1 v (whitening)
+Vector<6> u = lower_triangular(L) * w;         //u = L w
+Vector<6> y = lower_triangular(L).T() * w;     //y = L^T w
+@endcode
+Views are made with upper_triangular(), lower_triangular(),
+unit_upper_triangular() and unit_lower_triangular(). Like a slice, a view must
+not outlive the matrix it refers to.
+@ingroup gLinAlg
+**/
+template<int Size, class Precision, class Base, bool Upper, bool Unit=false>
+class TriangularMatrix
+{
+	public:
+		///Construct a view of the size x size matrix at data with the given strides.
+		///@internal
+		TriangularMatrix(const Precision* data, int size, int rowstride, int colstride, Internal::Slicing)
+		:my_matrix(data, size, size, rowstride, colstride, Internal::Slicing())
+		{}
+
+		///Is this an upper triangular view?
+		static const bool is_upper = Upper;
+		///Is the diagonal implicitly all ones?
+		static const bool is_unit = Unit;
+
+		///@name Sizes
+		///@{
+		int size() const { return my_matrix.num_rows(); }
+		int num_rows() const { return my_matrix.num_rows(); }
+		int num_cols() const { return my_matrix.num_cols(); }
+		///@}
+
+		///Return element (r, c) of the triangular matrix, which is zero outside the triangle.
+		Precision operator()(int r, int c) const
+		{
+			Internal::check_index(size(), r);
+			Internal::check_index(size(), c);
+			if(Unit && r == c)
+				return 1;
+			else if(Upper ? r <= c : r >= c)
+				return my_matrix(r, c);
+			else
+				return 0;
+		}
+
+		///The first column stored in row r.
+		int row_begin(int r) const { return Upper ? r + Unit : 0; }
+		///One past the last column stored in row r.
+		int row_end(int r) const { return Upper ? size() : r + 1 - Unit; }
+
+		///The underlying storage, including the elements outside the triangle.
+		const Matrix<Size, Size, const Precision, Base>& matrix() const
+		{
+			return my_matrix;
+		}
+
+		///The transpose, which is a view of the same storage with the opposite triangle.
+		TriangularMatrix<Size, Precision, typename Internal::TransposedSlice<Base>::type, !Upper, Unit> T() const
+		{
+			return TriangularMatrix<Size, Precision, typename Internal::TransposedSlice<Base>::type, !Upper, Unit>(my_matrix.my_data, size(), my_matrix.colstride(), my_matrix.rowstride(), Internal::Slicing());
+		}
+
+		///Copy the triangular matrix in to a dense matrix, with zeros outside the triangle.
+		Matrix<Size, Size, Precision> dense() const
+		{
+			Matrix<Size, Size, Precision> m(size(), size());
+			for(int r=0; r < size(); r++)
+				for(int c=0; c < size(); c++)
+					m[r][c] = (*this)(r, c);
+			return m;
+		}
+
+	private:
+		Matrix<Size, Size, const Precision, Base> my_matrix;
+};
+
+///@name Triangular views
+///@{
+
+///A view of the upper triangle of a matrix, including the diagonal. If m is
+///not square, the leading square block is used, so the view of the R
+///returned by QR is the usual triangular factor.
+///@relates TriangularMatrix
+template<int R, int C, class P, class B>
+TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, true> upper_triangular(const Matrix<R, C, P, B>& m)
+{
+	return TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, true>(m.my_data, std::min(m.num_rows(), m.num_cols()), m.rowstride(), m.colstride(), Internal::Slicing());
+}
+
+///A view of the lower triangle of a matrix, including the diagonal.
+///@relates TriangularMatrix
+template<int R, int C, class P, class B>
+TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, false> lower_triangular(const Matrix<R, C, P, B>& m)
+{
+	return TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, false>(m.my_data, std::min(m.num_rows(), m.num_cols()), m.rowstride(), m.colstride(), Internal::Slicing());
+}
+
+///A view of the strict upper triangle of a matrix, with an implicit unit diagonal.
+///@relates TriangularMatrix
+template<int R, int C, class P, class B>
+TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, true, true> unit_upper_triangular(const Matrix<R, C, P, B>& m)
+{
+	return TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, true, true>(m.my_data, std::min(m.num_rows(), m.num_cols()), m.rowstride(), m.colstride(), Internal::Slicing());
+}
+
+///A view of the strict lower triangle of a matrix, with an implicit unit
+///diagonal. This is the L factor stored in LU::get_lu().
+///@relates TriangularMatrix
+template<int R, int C, class P, class B>
+TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, false, true> unit_lower_triangular(const Matrix<R, C, P, B>& m)
+{
+	return TriangularMatrix<Internal::DiagSize<R, C>::size, P, typename Matrix<R, C, P, B>::SliceBase, false, true>(m.my_data, std::min(m.num_rows(), m.num_cols()), m.rowstride(), m.colstride(), Internal::Slicing());
+}
+
+///@}
+
+namespace Internal
+{
+	///@internal
+	///Triangular matrix times vector (TRMV), written to r.
+	///@ingroup gInternal
+	template<int S, class P, class B, bool Upper, bool Unit, int S2, class P2, class B2, int S3, class P3, class B3>
+	void triangular_multiply(const TriangularMatrix<S, P, B, Upper, Unit>& t, const Vector<S2, P2, B2>& v, Vector<S3, P3, B3>& r)
+	{
+		for(int i=0; i < t.size(); i++)
+		{
+			P3 s = Unit ? P3(v[i]) : P3(0);
+			for(int j=t.row_begin(i); j < t.row_end(i); j++)
+				s += t.matrix()(i, j) * v[j];
+			r[i] = s;
+		}
+	}
+
+	///@internal
+	///Triangular matrix times matrix (TRMM), written to r.
+	///@ingroup gInternal
+	template<int S, class P, class B, bool Upper, bool Unit, int R2, int C2, class P2, class B2, int R3, int C3, class P3, class B3>
+	void triangular_multiply(const TriangularMatrix<S, P, B, Upper, Unit>& t, const Matrix<R2, C2, P2, B2>& m, Matrix<R3, C3, P3, B3>& r)
+	{
+		for(int i=0; i < t.size(); i++)
+			for(int c=0; c < m.num_cols(); c++)
+			{
+				P3 s = Unit ? P3(m(i, c)) : P3(0);
+				for(int j=t.row_begin(i); j < t.row_end(i); j++)
+					s += t.matrix()(i, j) * m(j, c);
+				r(i, c) = s;
+			}
+	}
+
+	///@internal
+	///Solve t x = b in place (TRSV), where x initially holds b. Lower
+	///triangles are solved forwards and upper ones backwards, so each x[i]
+	///only uses elements which have already been found.
+	///@ingroup gInternal
+	template<int S, class P, class B, bool Upper, bool Unit, int S2, class P2, class B2>
+	void triangular_solve(const TriangularMatrix<S, P, B, Upper, Unit>& t, Vector<S2, P2, B2>& x)
+	{
+		const int n = t.size();
+		for(int k=0; k < n; k++)
+		{
+			const int i = Upper ? n - 1 - k : k;
+			P2 s = x[i];
+			for(int j=t.row_begin(i); j < t.row_end(i); j++)
+				if(j != i)
+					s -= t.matrix()(i, j) * x[j];
+			x[i] = Unit ? s : s / t.matrix()(i, i);
+		}
+	}
+
+	///@internal
+	///Solve t X = B in place (TRSM), where X initially holds B.
+	///@ingroup gInternal
+	template<int S, class P, class B, bool Upper, bool Unit, int R2, int C2, class P2, class B2>
+	void triangular_solve(const TriangularMatrix<S, P, B, Upper, Unit>& t, Matrix<R2, C2, P2, B2>& x)
+	{
+		const int n = t.size();
+		for(int k=0; k < n; k++)
+		{
+			const int i = Upper ? n - 1 - k : k;
+			for(int j=t.row_begin(i); j < t.row_end(i); j++)
+				if(j != i)
+					x[i] -= t.matrix()(i, j) * x[j];
+			if(!Unit)
+				x[i] /= t.matrix()(i, i);
+		}
+	}
+}
+
+///Multiply a triangular matrix by a vector (TRMV).
+///@relates TriangularMatrix
+template<int S1, class P1, class B1, bool Upper, bool Unit, int S2, class P2, class B2>
+Vector<Internal::Sizer<S1, S2>::size, typename Internal::MultiplyType<P1, P2>::type> operator*(const TriangularMatrix<S1, P1, B1, Upper, Unit>& t, const Vector<S2, P2, B2>& v)
+{
+	SizeMismatch<S1, S2>::test(t.size(), v.size());
+	TOON_INSTRUMENT_OPERATION("triangular * vector", 1.0*t.size()*t.size());
+	Vector<Internal::Sizer<S1, S2>::size, typename Internal::MultiplyType<P1, P2>::type> r(t.size());
+	Internal::triangular_multiply(t, v, r);
+	return r;
+}
+
+///Multiply a vector by a triangular matrix.
+///@relates TriangularMatrix
+template<int S1, class P1, class B1, int S2, class P2, class B2, bool Upper, bool Unit>
+Vector<Internal::Sizer<S1, S2>::size, typename Internal::MultiplyType<P1, P2>::type> operator*(const Vector<S1, P1, B1>& v, const TriangularMatrix<S2, P2, B2, Upper, Unit>& t)
+{
+	return t.T() * v;
+}
+
+///Multiply a triangular matrix by a matrix (TRMM).
+///@relates TriangularMatrix
+template<int S, class P1, class B1, bool Upper, bool Unit, int R, int C, class P2, class B2>
+Matrix<Internal::Sizer<S, R>::size, C, typename Internal::MultiplyType<P1, P2>::type> operator*(const TriangularMatrix<S, P1, B1, Upper, Unit>& t, const Matrix<R, C, P2, B2>& m)
+{
+	SizeMismatch<S, R>::test(t.size(), m.num_rows());
+	TOON_INSTRUMENT_OPERATION("triangular * matrix", 1.0*t.size()*t.size()*m.num_cols());
+	Matrix<Internal::Sizer<S, R>::size, C, typename Internal::MultiplyType<P1, P2>::type> r(t.size(), m.num_cols());
+	Internal::triangular_multiply(t, m, r);
+	return r;
+}
+
+///Multiply a matrix by a triangular matrix.
+///@relates TriangularMatrix
+template<int R, int C, class P1, class B1, int S, class P2, class B2, bool Upper, bool Unit>
+Matrix<R, Internal::Sizer<S, C>::size, typename Internal::MultiplyType<P1, P2>::type> operator*(const Matrix<R, C, P1, B1>& m, const TriangularMatrix<S, P2, B2, Upper, Unit>& t)
+{
+	SizeMismatch<C, S>::test(m.num_cols(), t.size());
+	TOON_INSTRUMENT_OPERATION("matrix * triangular", 1.0*t.size()*t.size()*m.num_rows());
+	Matrix<Internal::Sizer<S, C>::size, R, typename Internal::MultiplyType<P1, P2>::type> r(t.size(), m.num_rows());
+	Internal::triangular_multiply(t.T(), m.T(), r);
+	return r.T();
+}
+
+///Solve \f$Tx = b\f$ for x by forward or back substitution (TRSV).
+///@relates TriangularMatrix
+template<int S1, class P1, class B1, bool Upper, bool Unit, int S2, class P2, class B2>
+Vector<Internal::Sizer<S1, S2>::size, typename Internal::DivideType<P2, P1>::type> solve(const TriangularMatrix<S1, P1, B1, Upper, Unit>& t, const Vector<S2, P2, B2>& b)
+{
+	SizeMismatch<S1, S2>::test(t.size(), b.size());
+	TOON_INSTRUMENT_OPERATION("triangular solve", 1.0*t.size()*t.size());
+	Vector<Internal::Sizer<S1, S2>::size, typename Internal::DivideType<P2, P1>::type> x = b;
+	Internal::triangular_solve(t, x);
+	return x;
+}
+
+///Solve \f$TX = B\f$ for X (TRSM).
+///@relates TriangularMatrix
+template<int S, class P1, class B1, bool Upper, bool Unit, int R, int C, class P2, class B2>
+Matrix<Internal::Sizer<S, R>::size, C, typename Internal::DivideType<P2, P1>::type> solve(const TriangularMatrix<S, P1, B1, Upper, Unit>& t, const Matrix<R, C, P2, B2>& b)
+{
+	SizeMismatch<S, R>::test(t.size(), b.num_rows());
+	TOON_INSTRUMENT_OPERATION("triangular solve", 1.0*t.size()*t.size()*b.num_cols());
+	Matrix<Internal::Sizer<S, R>::size, C, typename Internal::DivideType<P2, P1>::type> x = b;
+	Internal::triangular_solve(t, x);
+	return x;
+}
+
+///Write a triangular matrix to a stream, in the same form as a Matrix.
+///@relates TriangularMatrix
+template<int S, class P, class B, bool Upper, bool Unit>
+std::ostream& operator<<(std::ostream& os, const TriangularMatrix<S, P, B, Upper, Unit>& t)
+{
+	return os << t.dense();
+}
+
+}
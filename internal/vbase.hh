@@ -102,9 +102,18 @@ struct VBase {
 		template<class Op>
 		VLayout(const Operator<Op>& op)
 			:GenericVBase<Size, Precision, 1, VectorAlloc<Size, Precision> >(op) {}
+
+		template<int N, class P2>
+		constexpr VLayout(Elements e, const P2 (&vals)[N])
+			:GenericVBase<Size, Precision, 1, VectorAlloc<Size, Precision> >(e, vals) {}
 	};
 };
 
+template<> struct InOrderStorage<VBase>
+{
+	static const bool value = true;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // Generic implementation
@@ -112,7 +121,7 @@ struct VBase {
 
 template<int Size, typename Precision, int Stride, typename Mem> struct GenericVBase: public Mem, public StrideHolder<Stride>
 {	
-	int stride() const{
+	constexpr int stride() const{
 		return StrideHolder<Stride>::stride();
 	}
 
@@ -138,19 +147,54 @@ template<int Size, typename Precision, int Stride, typename Mem> struct GenericV
 	template<class Op>
 	GenericVBase(const Operator<Op> & op) : Mem(op), StrideHolder<Stride>(op) {}
 
+	template<int N, class P2>
+	constexpr GenericVBase(Elements e, const P2 (&vals)[N]) : Mem(e, vals) {}
+
 	using Mem::data;
 	using Mem::size;
 
-	ReferenceType operator[](int i) {
+	constexpr ReferenceType operator[](int i) {
 		Internal::check_index(size(), i);
 		return data()[i * stride()];
 	}
 
-	ConstReferenceType operator[](int i) const {
+	constexpr ConstReferenceType operator[](int i) const {
 		Internal::check_index(size(), i);
 		return data()[i * stride()];
 	}
 
+	//Iterators: plain pointers for unit stride, otherwise strided.
+	typedef typename IteratorType<Stride, PointerType, ReferenceType>::type iterator;
+	typedef typename IteratorType<Stride, ConstPointerType, ConstReferenceType>::type const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	iterator begin() {
+		return IteratorType<Stride, PointerType, ReferenceType>::make(data(), 0, stride());
+	}
+
+	iterator end() {
+		return IteratorType<Stride, PointerType, ReferenceType>::make(data(), size(), stride());
+	}
+
+	const_iterator begin() const {
+		return IteratorType<Stride, ConstPointerType, ConstReferenceType>::make(data(), 0, stride());
+	}
+
+	const_iterator end() const {
+		return IteratorType<Stride, ConstPointerType, ConstReferenceType>::make(data(), size(), stride());
+	}
+
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+	const_reverse_iterator crend() const { return rend(); }
+
 	typedef SliceVBase<Stride, PointerType, ConstPointerType, ReferenceType, ConstReferenceType> SliceBase;
 	typedef SliceVBase<Stride, ConstPointerType, ConstPointerType, ConstReferenceType, ConstReferenceType> ConstSliceBase;
 
@@ -181,6 +225,17 @@ template<int Size, typename Precision, int Stride, typename Mem> struct GenericV
 		return slice<Start, Length>(Start, Length);
 	}
 
+	//Half dynamic slices: static length at a run-time position
+	template<int Length> Vector<Length, Precision, SliceBase> slice(int start){
+		static_assert(Length != Dynamic, "slice<Length>(start) needs a static length");
+		return slice<Dynamic, Length>(start, Length);
+	}
+
+	template<int Length> const Vector<Length, const Precision, ConstSliceBase> slice(int start) const {
+		static_assert(Length != Dynamic, "slice<Length>(start) needs a static length");
+		return slice<Dynamic, Length>(start, Length);
+	}
+
 	Vector<Dynamic, Precision, SliceBase> slice(int start, int length){
 		return slice<Dynamic, Dynamic>(start, length);
 	}
@@ -191,6 +191,28 @@ public:
 		op.eval(*this);
 	}
 
+	/// Construction from a list of elements, as made by makeVector().
+	/// Small statically sized vectors are initialised directly from the
+	/// elements, so this can be used in constant expressions.
+	template<int N, class P2>
+	constexpr Vector(const Operator<Internal::Data<N, P2> >& d)
+		:Vector(d, typename Internal::ElementInit<Size, Precision, Internal::InOrderStorage<Base>::value>::type())
+	{}
+
+	///@internal
+	template<int N, class P2>
+	constexpr Vector(const Operator<Internal::Data<N, P2> >& d, Internal::Elements e)
+		:Base::template VLayout<Size, Precision>(e, d.vals)
+	{}
+
+	///@internal
+	template<int N, class P2>
+	inline Vector(const Operator<Internal::Data<N, P2> >& d, Internal::EvalElements)
+		:Base::template VLayout<Size, Precision>(d)
+	{
+		d.eval(*this);
+	}
+
 	// Copy construction is a very special case. Copy construction goes all the
 	// way down to the bottom. GenericVBase has no idea how to copy itself.
 	// However, the underlying allocator objects do.  In the case of static sized
@@ -252,6 +274,15 @@ public:
 		return *this;
 	}
 
+	/// Move assignment. The data is taken from \e from without copying
+	/// if the vector owns data on the heap, otherwise it is copied.
+	/// A size mismatch is a fatal error, unless the destination
+	/// is resizable.
+	inline Vector& operator= (Vector&& from){
+		Internal::MoveAssign<Vector>::assign(*this, from);
+		return *this;
+	}
+
 	/// operator = another Vector
 	/// A size mismatch is a fatal error, unless the destination
 	/// is resizable.
@@ -383,9 +414,10 @@ public:
 	int size() const;
 	
 	/// Resize the vector. This is only provided if the vector is
-	/// declared as Resizable. Existing elements are retained, new
-	/// elements are uninitialized. Resizing has the same efficiency
-	/// guarantees as <code>std::vector</code>.
+	/// declared as Resizable or with Bounded storage. Existing elements
+	/// are retained, new elements are uninitialized. Resizing has the
+	/// same efficiency guarantees as <code>std::vector</code>. Bounded
+	/// vectors can not be resized beyond their capacity.
 	/// @param s The new size.
 	///
 	/// @internal
@@ -503,6 +535,20 @@ public:
 	*/
 	template<Start, Length>
 	Vector<Length,Precision>& slice();
+
+	/**
+	   Extract a sub-vector of static length at a runtime position. The
+	   length is part of the type, so operations on the slice are unrolled
+	   just as for other statically sized vectors.
+	   @code
+	   Vector<> a(20);
+	   a.slice<6>(i) = makeVector(1,2,3,4,5,6); //Set elements i ... i+5
+	   @endcode
+	   @internal
+	   This method is not defined by Vector: it is inherited.
+	*/
+	template<Length>
+	Vector<Length,Precision>& slice(int start);
 	//@}
 
 #endif
@@ -0,0 +1,55 @@
+#Compare a measured run time against the stored baseline.
+#
+#Usage: awk -vname=NAME -vf1=MEASURED -vf2=BASELINE [-vtol=TOL] -f perfdiff.awk
+#
+#MEASURED contains a single line "name min_ns median_ns p99_ns" as written by
+#benchmark/perf_regression.cc. BASELINE contains lines "name min_ns".
+#Lines in the baseline starting with # and blank lines are ignored.
+#
+#The test fails if the measured time exceeds the baseline by more than
+#the fraction tol (default 0.25). A test with no baseline is reported as a
+#warning, since it has not been checked: add it with "make perfbaseline".
+
+function fail(x)
+{
+	print name " Failed " x
+	exit(0)
+}
+
+BEGIN{
+	if(tol == "")
+		tol = 0.25
+
+	if((getline line < f1) <= 0)
+		fail("no timing")
+
+	if(line == "Crash!!!" || line == "Compile error!")
+		fail(line)
+
+	split(line, m)
+	measured = m[2]
+
+	baseline = ""
+	while((getline line < f2) > 0)
+	{
+		if(line ~ /^[ 	]*(#|$)/)
+			continue
+
+		split(line, b)
+		if(b[1] == name)
+			baseline = b[2]
+	}
+
+	if(baseline == "")
+	{
+		print name " Warning: no baseline (" measured " ns)"
+		exit(0)
+	}
+
+	ratio = measured / baseline
+
+	if(ratio > 1 + tol)
+		fail(sprintf("slower: %.0f ns against baseline %.0f ns (x%.2f, tolerance x%.2f)", measured, baseline, ratio, 1+tol))
+	else
+		print name " Passed " sprintf("(x%.2f)", ratio)
+}
@@ -0,0 +1,81 @@
+#include "regressions/regression.h"
+#include <TooN/rotation_averaging.h>
+
+int main()
+{
+	//The nearest rotation to a matrix with a negative determinant
+	const Matrix<3> reflection = Data(0, 2, 0, 1, 0, 0, 0, 0, 0.1);
+	const Matrix<3> swap = Data(0, 1, 0, 1, 0, 0, 0, 0, -1);
+	cout << (norm_inf(Internal::nearest_rotation(reflection) - swap) < 1e-12) << " ";
+
+	//Rotations placed symmetrically about a known rotation average to it
+	const SO3<> centre = SO3<>::exp(makeVector(0.3, -1.2, 0.7));
+	std::vector<SO3<> > rotations;
+	for(int i=0; i < 3; i++) {
+		Vector<3> d = Zeros;
+		d[i] = 0.2 + 0.1 * i;
+		rotations.push_back(centre * SO3<>::exp(d));
+		rotations.push_back(centre * SO3<>::exp(-d));
+	}
+	cout << (norm_inf((centre.inverse() * mean(rotations.begin(), rotations.end())).ln()) < 1e-12) << " ";
+
+	//The weighted mean of two rotations lies on the geodesic between them
+	const SO3<> a = SO3<>::exp(makeVector(0.1, 0.2, 0.3)), b = SO3<>::exp(makeVector(-0.4, 0.5, 0.1));
+	const SO3<> pair[2] = {a, b};
+	const double pair_weights[2] = {1, 3};
+	const SO3<> expected = a * SO3<>::exp(0.75 * (a.inverse() * b).ln());
+	cout << (norm_inf((expected.inverse() * mean(pair, pair + 2, pair_weights)).ln()) < 1e-12) << " ";
+
+	//A spread of rotations: the mean satisfies the first order condition
+	std::vector<SO3<> > spread;
+	std::vector<double> weights;
+	for(int i=0; i < 50; i++) {
+		spread.push_back(centre * SO3<>::exp(makeVector(0.4*sin(i), 0.3*cos(1.7*i), 0.5*sin(2.3*i + 1))));
+		weights.push_back(1 + (i % 3));
+	}
+	const SO3<> m = mean(spread.begin(), spread.end(), weights.begin());
+	Vector<3> gradient = Zeros;
+	for(size_t i=0; i < spread.size(); i++)
+		gradient += weights[i] * (m.inverse() * spread[i]).ln();
+	cout << (norm_inf(gradient) < 1e-10) << " ";
+
+	//The same for SE3
+	std::vector<SE3<> > poses;
+	for(int i=0; i < 50; i++)
+		poses.push_back(SE3<>(spread[i], makeVector(sin(i), 2*cos(i), i * 0.1)));
+	const SE3<> pm = mean(poses.begin(), poses.end(), weights.begin());
+	Vector<6> gradient6 = Zeros;
+	for(size_t i=0; i < poses.size(); i++)
+		gradient6 += weights[i] * (pm.inverse() * poses[i]).ln();
+	cout << (norm_inf(gradient6) < 1e-10) << " ";
+	const SE3<> single = mean(poses.begin(), poses.begin() + 1);
+	cout << (norm_inf((single.inverse() * poses[0]).ln()) < 1e-12) << endl;
+
+	//Chordal rotation averaging recovers exact absolute rotations from a graph
+	//with cycles and repeated measurements, up to the rotation of node 0
+	const int nodes = 6;
+	std::vector<SO3<> > truth;
+	for(int i=0; i < nodes; i++)
+		truth.push_back(SO3<>::exp(makeVector(sin(3.0*i), cos(2.0*i), 0.5*i)));
+	std::vector<RelativeRotation<> > edges;
+	for(int i=0; i < nodes; i++)
+		for(int j=0; j < nodes; j++)
+			if(i != j && (i + j) % 3 != 0)
+				edges.push_back({i, j, truth[i].inverse() * truth[j], 1.0 + i});
+	std::vector<SO3<> > estimate = chordal_rotation_averaging(nodes, edges);
+	double error = 0;
+	for(int i=0; i < nodes; i++)
+		error = max(error, norm_inf((estimate[i].inverse() * truth[0].inverse() * truth[i]).ln()));
+	cout << (estimate.size() == size_t(nodes)) << " " << (error < 1e-10) << " ";
+
+	//With noise the estimate is close to the truth
+	for(size_t e=0; e < edges.size(); e++)
+		edges[e].rotation = edges[e].rotation * SO3<>::exp(makeVector(0.01*sin(e), 0.01*cos(3.0*e), -0.01*sin(7.0*e)));
+	estimate = chordal_rotation_averaging(nodes, edges);
+	error = 0;
+	for(int i=0; i < nodes; i++)
+		error = max(error, norm_inf((estimate[i].inverse() * truth[0].inverse() * truth[i]).ln()));
+	cout << (error < 0.01) << endl;
+
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include "regressions/regression.h"
+#include <TooN/banded.h>
+#include <TooN/Cholesky.h>
+
+bool small(double x)
+{
+	return x < 1e-8;
+}
+
+int main()
+{
+	//Unsymmetric band: products match the dense versions
+	Matrix<6> M;
+	for(int r=0; r < 6; r++)
+		for(int c=0; c < 6; c++)
+			M(r,c) = 1 + r + 2*c;
+
+	BandedMatrix<1, 2> B(M);
+	cout << B << endl;
+	Vector<6> v = makeVector(1, -2, 3, 0.5, 2, -1);
+	cout << B * v << endl << B.dense() * v << endl;
+	cout << v * B << endl << v * B.dense() << endl;
+
+	//A smoothing spline: identity plus a second difference penalty
+	Matrix<1, 3> D2 = Data(1, -2, 1);
+	Matrix<1> w = Data(10);
+	const int n = 10;
+	BandedMatrix<2> A(n);
+	A = Identity;
+	for(int i=0; i < n-2; i++)
+		A.add_sparse_JtWJ(D2, i, w);
+	cout << A << endl;
+
+	Vector<> b(n);
+	for(int i=0; i < n; i++)
+		b[i] = i*i % 7;
+
+	BandedCholesky<2> chol(A);
+	Cholesky<> dchol(A.dense());
+	cout << chol.rank() << endl;
+	cout << small(norm_inf(chol.backsub(b) - dchol.backsub(b))) << endl;
+	cout << small(std::abs(chol.determinant() - dchol.determinant())/dchol.determinant()) << endl;
+	Matrix<> X = chol.backsub(A.dense());
+	cout << small(norm_fro(X - Matrix<>(Identity(n)))) << endl;
+
+	//Two block Jacobians, as used by WLS::add_sparse_mJ_rows
+	BandedMatrix<2> A2(n);
+	A2 = Identity;
+	Matrix<1, 2> J1 = Data(1, -2);
+	Matrix<1, 1> J2 = Data(1);
+	for(int i=0; i < n-2; i++)
+		A2.add_sparse_JtWJ(J1, i, J2, i+2, w);
+	cout << small(norm_fro(A2.dense() - A.dense())) << endl;
+
+	//A large problem
+	const int big = 100000;
+	BandedMatrix<2> L(big);
+	L = Identity;
+	for(int i=0; i < big-2; i++)
+		L.add_sparse_JtWJ(D2, i, w);
+	Vector<> y(big);
+	for(int i=0; i < big; i++)
+		y[i] = std::sin(i * 0.001) + (i % 3) * 0.1;
+	BandedCholesky<2> lchol(L);
+	cout << small(norm_inf(L * lchol.backsub(y) - y)) << endl;
+
+	return 0;
+}
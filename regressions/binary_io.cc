@@ -0,0 +1,131 @@
+#include "regressions/regression.h"
+#include <TooN/binary_io.h>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+
+typedef Vector<Dynamic, double, Bounded<6> > BVector;
+
+void print_header(const BinaryHeader& h)
+{
+	cout << h.version << " " << h.precision << " " << h.element_size << " " << h.column_major << " " << h.is_vector << " " << h.rows << " " << h.cols << endl;
+}
+
+int main()
+{
+	//Vectors
+	{
+		stringstream s;
+		save(s, makeVector(1., 2., 3.));
+		Vector<6> v = makeVector(1, 2, 3, 4, 5, 6);
+		save(s, v.slice<0, 3>());
+		Matrix<3, 2> m = Data(1, 2, 3, 4, 5, 6);
+		save(s, m.T()[1]);
+		save(s, v);
+
+		Vector<3> a = Zeros;
+		Vector<Resizable> r;
+		BVector b;
+		Vector<> d(6);
+		load(s, a);
+		load(s, r);
+		load(s, b);
+		load(s, d);
+		cout << a << endl << r << endl << b << endl << d << endl << s.good() << endl;
+	}
+
+	//Matrices
+	{
+		Matrix<3, 4> m;
+		for(int r=0; r < 3; r++)
+			for(int c=0; c < 4; c++)
+				m(r,c) = r*10+c;
+
+		Matrix<3, 4, double, ColMajor> mc = m;
+
+		stringstream s;
+		save(s, m);
+		save(s, mc);
+		save(s, m.T());
+		save(s, m.slice<1, 1, 2, 2>());
+
+		BinaryHeader h;
+		read_header(s, h);
+		print_header(h);
+		s.seekg(0);
+
+		Matrix<3, 4, double, ColMajor> m1;
+		Matrix<3, 4> m2;
+		load(s, m1);
+		load(s, m2);
+		Matrix<> m3 = load_matrix(s);
+		Matrix<> m4 = load_matrix(s);
+		cout << m1 << endl << m2 << endl << m3 << endl << m4 << endl << s.good() << endl;
+	}
+
+	//Errors
+	{
+		stringstream s;
+		save(s, makeVector(1., 2., 3.));
+		Vector<4> v;
+		load(s, v);
+		cout << s.fail() << endl;
+
+		s.clear();
+		s.seekg(0);
+		Vector<3, float> f;
+		load(s, f);
+		cout << s.fail() << endl;
+
+		s.clear();
+		s.seekg(0);
+		Matrix<2, 2> m;
+		load(s, m);
+		cout << s.fail() << endl;
+
+		stringstream t("not a TooN file, but long enough to contain a header for the purposes of this test");
+		Matrix<> n = load_matrix(t);
+		cout << t.fail() << " " << n.num_rows() << " " << n.num_cols() << endl;
+	}
+
+	//Mapped files
+	{
+		char name[] = "/tmp/toon_binary_io_XXXXXX";
+		int fd = mkstemp(name);
+		close(fd);
+
+		Matrix<> m = Zeros(3, 5);
+		for(int i=0; i < 3; i++)
+			m(i, i+2) = i+1;
+
+		{
+			ofstream f(name, ios::binary);
+			save(f, m);
+		}
+
+		MappedMatrix<> mm(name);
+		cout << mm.is_open() << endl;
+		cout << mm.matrix() << endl;
+		cout << mm.matrix() * Vector<5>(Ones) << endl;
+
+		MappedMatrix<float> mf(name);
+		MappedMatrix<double, Reference::ColMajor> mc(name);
+		MappedVector<> mv(name);
+		cout << mf.is_open() << mc.is_open() << mv.is_open() << " " << mf.matrix().num_rows() << endl;
+
+		{
+			ofstream f(name, ios::binary);
+			save(f, makeVector(4., 5., 6.));
+		}
+		MappedVector<> v(name);
+		cout << v.is_open() << " " << v.vector() << endl;
+
+		MappedMatrix<> missing("/nonexistent/toon/file");
+		cout << missing.is_open() << endl;
+
+		unlink(name);
+	}
+
+	return 0;
+}
@@ -0,0 +1,43 @@
+#include "regressions/regression.h"
+#include <TooN/block_diagonal.h>
+
+bool small(double x)
+{
+	return x < 1e-10;
+}
+
+int main()
+{
+	BlockDiagonalMatrix<3> A(3);
+	A = Zeros;
+
+	//Per-block measurements, as used by WLS::add_sparse_mJ_rows
+	Matrix<2, 3> J = Data(1, 2, 0,
+	                      0, 1, 3);
+	Matrix<2> W = Data(2, 1,
+	                   1, 3);
+	for(int i=0; i < A.num_blocks(); i++)
+	{
+		A.add_sparse_JtWJ(J, 3*i, W);
+		A.add_sparse_JtWJ(Matrix<1, 1>(Data(i+1.)), 3*i+2, Matrix<1, 1>(Data(1.)));
+		A.block(i) += Matrix<3>(Identity);
+	}
+	cout << A.dense() << endl;
+	cout << A(0, 1) << " " << A(1, 4) << " " << A(8, 8) << endl;
+
+	Vector<9> v = makeVector(1, -2, 3, 0.5, 2, -1, 0, 1, 4);
+	cout << A * v << endl << A.dense() * v << endl;
+	cout << v * A << endl << v * A.dense() << endl;
+
+	BlockDiagonalCholesky<3> chol(A);
+	cout << chol.rank() << endl;
+	cout << small(norm_inf(A * chol.backsub(v) - v)) << endl;
+	cout << small(norm_fro(A.dense() * chol.get_inverse().dense() - Matrix<>(Identity(9)))) << endl;
+	cout << chol.determinant() << endl;
+
+	BlockDiagonalMatrix<3> I(2);
+	I = Identity;
+	cout << I.dense() << endl;
+
+	return 0;
+}
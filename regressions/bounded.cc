@@ -0,0 +1,74 @@
+#define TOON_TEST_INTERNALS
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+
+typedef Matrix<Dynamic, Dynamic, double, Bounded<4, 3> > BMatrix;
+typedef Vector<Dynamic, double, Bounded<4> > BVector;
+
+int main()
+{
+	BMatrix J(4, 3);
+	J = Data(1, 2, 0,
+	         0, 1, 1,
+	         2, 0, 1,
+	         1, 1, 1);
+	BVector r = makeVector(1, 2, 3, 4);
+	Matrix<3, 2> S = Data(1, 0, 0, 1, 1, 1);
+
+	try
+	{
+		NoAllocGuard no_alloc;
+
+		//Results of operators on Bounded objects are Bounded
+		cout << J.T() * J << endl;
+		cout << J.T() * r << endl;
+		cout << r * J << endl;
+		cout << J * makeVector(1, 1, 1) << endl;
+		cout << J * S << endl;
+		cout << (J + J) - J * 2 << endl;
+		cout << -J / 2 << endl;
+		cout << diagmult(r, J) << endl;
+		cout << (r + r) * 0.5 - r << endl;
+		cout << J.T() * J + Identity << endl;
+		cout << J.T().T() * 3.0 << endl;
+
+		//Decompositions with a Bounded layout
+		Cholesky<Dynamic, double, Bounded<3> > chol(J.T() * J);
+		BVector g = J.T() * r;
+		BVector x = chol.backsub(g);
+		cout << x << endl;
+		cout << J.T() * J * x - g << endl;
+		cout << chol.get_inverse() * (J.T() * J) << endl;
+		cout << chol.determinant() << endl;
+		cout << chol.backsub(J.T()) << endl;
+	}
+	catch(Internal::HeapAllocation)
+	{
+		cout << "heap allocation" << endl;
+	}
+
+	//Mixing with heap storage gives heap storage
+	Matrix<> D = J;
+	cout << D.T() * J << endl;
+
+	//Sizes beyond the capacity
+	try
+	{
+		BMatrix M(5, 3);
+	}
+	catch(Internal::BoundedOverflow)
+	{
+		cout << "overflow" << endl;
+	}
+
+	try
+	{
+		BMatrix M(Zeros(4, 4));
+	}
+	catch(Internal::BoundedOverflow)
+	{
+		cout << "overflow" << endl;
+	}
+
+	return 0;
+}
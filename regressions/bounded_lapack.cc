@@ -0,0 +1,38 @@
+#define TOON_TEST_INTERNALS
+#include "regressions/regression.h"
+#include <TooN/SymEigen.h>
+
+typedef Matrix<Dynamic, Dynamic, double, Bounded<4> > BMatrix;
+typedef Vector<Dynamic, double, Bounded<4> > BVector;
+
+int main()
+{
+	cout << setprecision(6) << fixed;
+
+	BMatrix A(3, 3);
+	A = Data(4, 1, 0,
+	         1, 3, 1,
+	         0, 1, 2);
+	BVector b = makeVector(1, 2, 3);
+
+	try
+	{
+		NoAllocGuard no_alloc;
+
+		LU<Dynamic, double, Bounded<4> > lu(A);
+		cout << lu.determinant() << endl;
+		cout << lu.get_inverse() * A << endl;
+		cout << A * (lu.get_inverse() * b) - b << endl;
+
+		SymEigen<Dynamic, double, Bounded<4> > eig(A);
+		cout << eig.get_evalues() << endl;
+		cout << A * eig.backsub(b) - b << endl;
+		cout << eig.get_sqrtm().T() * eig.get_sqrtm() - A << endl;
+	}
+	catch(Internal::HeapAllocation)
+	{
+		cout << "heap allocation" << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+#include "regressions/regression.h"
+#include <TooN/charconv.h>
+#include <sstream>
+#include <cstring>
+
+int main()
+{
+	//Parsing
+	{
+		const char* s = "  1.5, 2\t-3e-2\n4 rest";
+		Vector<4> v;
+		const char* end = from_chars(s, s + strlen(s), v);
+		cout << v << endl << (end - s) << endl;
+
+		Vector<5> w;
+		cout << (from_chars(s, s + strlen(s), w) == 0) << endl;
+
+		Matrix<2, 3> m;
+		const char* t = "1 2 3\n4 5 6\n";
+		from_chars(t, t + strlen(t), m);
+		cout << m << endl;
+
+		//A leading '+' is accepted, but hexadecimal is not
+		const char* u = "+2.5 -1 +4e1";
+		Vector<3> p;
+		cout << (from_chars(u, u + strlen(u), p) == u + strlen(u)) << " " << p << endl;
+		const char* h = "0x10 1";
+		Vector<2> q;
+		cout << (from_chars(h, h + strlen(h), q) == 0) << endl;
+	}
+
+	//Shortest round trip output
+	{
+		Vector<4> v = makeVector(0.1, 1.0/3, 1e300, -2.5);
+		string s = to_string(v);
+		cout << s << endl;
+
+		Vector<4> w;
+		from_chars(s.data(), s.data() + s.size(), w);
+		cout << (v == w) << endl;
+
+		Vector<2, float> f = makeVector(0.1f, 1.0f/3);
+		cout << to_string(f, ',') << endl;
+
+		Matrix<2> m = Data(1, 0.5, -0.25, 100);
+		cout << to_string(m);
+
+		char buf[5];
+		cout << (to_chars(buf, buf + sizeof(buf), v) == 0) << endl;
+	}
+
+	//Lie groups round trip through the stream operators
+	{
+		SE3<> pose = SE3<>::exp(makeVector(1, 2, 3, 0.1, -0.2, 0.3));
+		string s = to_string(pose);
+
+		SE3<> a, b;
+		istringstream is(s);
+		is >> a;
+		from_chars(s.data(), s.data() + s.size(), b);
+		cout << (norm(a.ln() - pose.ln()) < 1e-12) << " " << (norm(b.ln() - pose.ln()) < 1e-12) << endl;
+
+		SO3<> rot = SO3<>::exp(makeVector(0.3, 0.2, 0.1));
+		SO3<> r;
+		s = to_string(rot);
+		from_chars(s.data(), s.data() + s.size(), r);
+		cout << (norm(r.ln() - rot.ln()) < 1e-12) << endl;
+	}
+
+	//Streaming reader
+	{
+		istringstream is("# time, x, y\n1, 2, 3\n\n4,5,6\n  7 8 9\n");
+		cout << read_matrix(is) << endl;
+
+		istringstream is2("1 2\n3 4 5\n");
+		RowReader<> reader(is2);
+		Vector<Resizable> v;
+		while(reader.read(v))
+			cout << v << endl;
+
+		istringstream is3("1 2\n3 4 5\n");
+		Matrix<> m = read_matrix(is3);
+		cout << is3.fail() << " " << m.num_rows() << " " << m.num_cols() << endl;
+
+		istringstream is4("1 2 3\n1 x 3\n");
+		RowReader<> reader4(is4);
+		Vector<3> u;
+		cout << reader4.read(u) << " " << u << endl;
+		cout << reader4.read(u) << " " << is4.fail() << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,35 @@
+//The C library fallback for text conversion must not depend on the locale.
+#define TOON_NO_CHARCONV
+#include "regressions/regression.h"
+#include <TooN/charconv.h>
+#include <clocale>
+#include <cstring>
+
+int main()
+{
+	//Use a decimal comma locale if there is one. The output is the same either way.
+	const char* names[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR", ""};
+	for(const char* name: names)
+		if(std::setlocale(LC_NUMERIC, name) && std::strcmp(std::localeconv()->decimal_point, ".") != 0)
+			break;
+
+	const char* s = "1.5 -2.25e-3, 0.1\n1e10";
+	Vector<4> v;
+	const char* end = from_chars(s, s + std::strlen(s), v);
+	std::setlocale(LC_NUMERIC, "C");
+	cout << v << (end - s) << endl;
+
+	for(const char* name: names)
+		if(std::setlocale(LC_NUMERIC, name) && std::strcmp(std::localeconv()->decimal_point, ".") != 0)
+			break;
+
+	const std::string text = to_string(makeVector(0.1, -1.5, 1.0/3, 2.5e-20), ',');
+	Vector<4> w;
+	from_chars(text.data(), text.data() + text.size(), w);
+	const std::string pose = to_string(SE3<>::exp(makeVector(1, 2, 3, 0.1, -0.2, 0.3)));
+	std::setlocale(LC_NUMERIC, "C");
+	cout << text << endl;
+	cout << (w == makeVector(0.1, -1.5, 1.0/3, 2.5e-20)) << " " << (std::strchr(pose.c_str(), ',') == 0) << endl;
+
+	return 0;
+}
@@ -50,5 +50,6 @@ int main()
 	Vector<Dynamic, complex<double> > v3 = makeVector(1, 2, 3);
 	cout << v3 << endl;
 	cout << v3.size() << endl;
-	
+
+	return 0;
 }
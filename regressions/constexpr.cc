@@ -0,0 +1,56 @@
+#include "regressions/regression.h"
+#include <TooN/so2.h>
+#include <TooN/se2.h>
+#include <TooN/so3.h>
+#include <TooN/se3.h>
+
+//Small statically sized objects can be built and read at compile time
+constexpr Vector<3> v = makeVector(1, 2.5, 3);
+static_assert(v.size() == 3 && v[1] == 2.5, "makeVector is not constexpr");
+
+constexpr Vector<2, int> iv = makeVector(4, 5);
+static_assert(iv[0] + iv[1] == 9, "makeVector<int> is not constexpr");
+
+constexpr Matrix<2, 3> m = Data(1, 2, 3, 4, 5, 6);
+static_assert(m.num_rows() == 2 && m.num_cols() == 3 && m(1, 0) == 4, "Data is not constexpr");
+
+constexpr Matrix<2, 2, float> f = Data<float>(1, 2, 3, 4.5);
+static_assert(f(1, 1) == 4.5f, "Data<float> is not constexpr");
+
+constexpr double trace(const Matrix<3>& a)
+{
+	double t = 0;
+	for(int i=0; i < 3; i++)
+		t += a(i, i);
+	return t;
+}
+
+constexpr Matrix<3> G0 = SO3<>::generator(0);
+static_assert(G0(2, 1) == 1 && G0(1, 2) == -1 && trace(G0) == 0, "SO3 generator is not constexpr");
+static_assert(SE3<>::generator(1)(1, 3) == 1, "SE3 generator is not constexpr");
+static_assert(SO2<>::generator()(1, 0) == 1, "SO2 generator is not constexpr");
+static_assert(SE2<>::generator(2)(0, 1) == -1, "SE2 generator is not constexpr");
+
+int main()
+{
+	cout << v << endl;
+	cout << m << endl;
+	cout << f << endl;
+
+	//The generators match their definitions
+	for(int i=0; i < 3; i++)
+		cout << SO3<>::generator(i) << endl;
+	for(int i=0; i < 6; i++)
+		cout << SE3<>::generator(i) << endl;
+	cout << SO2<>::generator() << endl;
+	for(int i=0; i < 3; i++)
+		cout << SE2<>::generator(i) << endl;
+
+	//Other layouts are filled at run time
+	Matrix<2, 2, double, ColMajor> c = Data(1, 2, 3, 4);
+	cout << c << endl;
+	Vector<2, double, Stack> s = makeVector(7, 8);
+	cout << s << endl;
+
+	return 0;
+}
@@ -350,4 +350,5 @@ int main(){
 		cout << setprecision(14) << determinant(n) << " " << determinant_gaussian_elimination(n) << " " << determinant_LU(n) << endl;
 	}
 
+	return 0;
 }
@@ -30,4 +30,6 @@ int main()
 	DiagonalMatrix<3> d3(Data(1, 2, 3));
 
 	cout << Matrix<3>(d3) << endl;
+
+	return 0;
 }
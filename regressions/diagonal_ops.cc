@@ -0,0 +1,56 @@
+#include <TooN/TooN.h>
+using namespace TooN;
+using namespace std;
+
+int main()
+{
+	DiagonalMatrix<3> d3(Data(1, 2, 3));
+
+	//Sums and differences with dense matrices
+	Matrix<3> m4 = Data(1, 2, 3,
+	                    4, 5, 6,
+	                    7, 8, 9);
+	cout << m4 + d3 << endl;
+	cout << d3 + m4 << endl;
+	cout << m4 - d3 << endl;
+	cout << d3 - m4 << endl;
+	m4 += d3;
+	cout << m4 << endl;
+	m4 -= d3;
+	cout << m4 << endl;
+
+	//Levenberg-Marquardt damping, where the diagonal is part of the matrix
+	m4 = m4 + 0.5 * m4.diagonal_slice().as_diagonal();
+	cout << m4 << endl;
+
+	//Diagonal with diagonal and scalars
+	cout << Matrix<3>(d3 + d3) << endl;
+	cout << Matrix<3>(d3 - 2 * d3) << endl;
+	cout << Matrix<3>(d3 / 2) << endl;
+	cout << Matrix<3>(inverse(d3)) << endl;
+	cout << inverse(d3) * d3.my_vector << endl;
+
+	//In place updates do not allocate
+	Matrix<> M = Matrix<3>(Data(4, 1, 0, 1, 5, 2, 0, 2, 6)), R = M;
+	Vector<> dv = makeVector(1, 2, 3);
+	{
+		NoAllocGuard no_alloc;
+		R += dv.as_diagonal();
+		R -= 2 * Vector<3>(dv).as_diagonal();
+		R += M.diagonal_slice().as_diagonal();
+	}
+	cout << R << endl;
+
+	//Nor do expressions with static sizes
+	{
+		NoAllocGuard no_alloc;
+		const Matrix<3> A = Data(4, 1, 0, 1, 5, 2, 0, 2, 6);
+		const Vector<3> e = makeVector(1, 2, 3);
+		Matrix<3> B = A + e.as_diagonal();
+		B = e.as_diagonal() - B;
+		B = A * e.as_diagonal() + inverse(e.as_diagonal());
+		cout << B << endl;
+	}
+
+	return 0;
+}
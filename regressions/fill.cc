@@ -58,4 +58,6 @@ int main()
 
 		cout << D << endl;
 	}
+
+	return 0;
 }
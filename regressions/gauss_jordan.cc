@@ -62,4 +62,5 @@ int main()
 	cout << id_failures << endl;
 	cout << max_error << endl;
 
+	return 0;
 }
@@ -36,5 +36,7 @@ int main()
 	}
 
 	cout << err << endl;
+
+	return 0;
 }
 
@@ -13,4 +13,6 @@ int main()
 	cout << setprecision(16);
 	cout << "Static: \n";
 	cout << a.get_pinv() <<endl;
+
+	return 0;
 }
@@ -0,0 +1,42 @@
+//Check that code using the explicit instantiations links against the
+//library and works.
+#include <TooN/instances.h>
+#include "regressions/regression.h"
+
+bool small(double x)
+{
+	return std::abs(x) < 1e-6;
+}
+
+int main()
+{
+	Matrix<3> A = Data(4, 1, 0,
+	                   1, 5, 2,
+	                   0, 2, 6);
+	Vector<3> b = makeVector(1, 2, 3);
+
+	Cholesky<3> c(A);
+	cout << c.determinant() << " " << small(norm_inf(A * c.backsub(b) - b)) << endl;
+
+	const Matrix<> D = A;
+	Cholesky<> cd(D);
+	cout << cd.determinant() << " " << cd.rank() << endl;
+
+	const Matrix<Dynamic, Dynamic, float> F = Matrix<3, 3, float>(Data<float>(4, 1, 0, 1, 5, 2, 0, 2, 6));
+	Cholesky<Dynamic, float> cf(F);
+	cout << cf.determinant() << endl;
+
+	WLS<3> wls;
+	wls.add_mJ(1, makeVector(1., 0., 0.));
+	wls.add_mJ(2, makeVector(0., 1., 0.));
+	wls.add_mJ(3, makeVector(0., 0., 1.));
+	wls.compute();
+	cout << wls.get_mu() << endl;
+
+	SE3<> p = SE3<>::exp(makeVector(1, 2, 3, 0.1, 0.2, 0.3));
+	cout << small(norm_inf(p.ln() - makeVector(1, 2, 3, 0.1, 0.2, 0.3))) << endl;
+	SO3<float> r = SO3<float>::exp(makeVector(0.1f, 0.2f, 0.3f));
+	cout << r.ln() << endl;
+
+	return 0;
+}
@@ -0,0 +1,94 @@
+#define TOON_INSTRUMENT
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+
+void print_counts()
+{
+	const Instrument::Report& r = Instrument::report();
+	cout << r.allocations << " " << r.bytes_allocated << " " << r.copies << " " << r.bytes_copied << endl;
+}
+
+void print_operation(const char* name)
+{
+	const Instrument::Operation& op = Instrument::report().operations[name];
+	cout << op.calls << " " << op.flops << endl;
+}
+
+int main()
+{
+	//Dynamic storage
+	Instrument::reset();
+	{
+		Vector<> v = Zeros(10);
+		Vector<> w = v;
+		Matrix<> m = Zeros(3, 4);
+		Matrix<> n = m;
+	}
+	print_counts();
+
+	//Static storage: copies, but no allocations
+	Instrument::reset();
+	{
+		Vector<3> a = makeVector(1, 2, 3);
+		Vector<3> b = a;
+		Matrix<2> m = Identity;
+		Matrix<2> n = m;
+		cout << b << n;
+	}
+	print_counts();
+
+	//Static storage too large for the stack
+	Instrument::reset();
+	{
+		Matrix<20> m = Zeros;
+		Matrix<20> n = m;
+	}
+	print_counts();
+
+	//Resizable vectors count growth of the storage only.
+	Instrument::reset();
+	{
+		Vector<Resizable> v;
+		v.resize(4);
+		v.resize(2);
+		v.resize(3);
+	}
+	print_counts();
+
+	//Operators and decompositions
+	Instrument::reset();
+	{
+		Matrix<> a = Identity(4);
+		Matrix<> b = Zeros(4, 5);
+		Matrix<> c = a * b;
+		Vector<> v = Ones(5);
+		Vector<> u = c * v;
+		Vector<> x = u + u;
+
+		Matrix<3> I = Identity;
+		Cholesky<3> chol(I);
+		chol.compute(I);
+	}
+	print_operation("matrix * matrix");
+	print_operation("matrix * vector");
+	print_operation("vector pairwise");
+	print_operation("Cholesky");
+	cout << Instrument::report().flops() << endl;
+
+	//Adding a diagonal matrix allocates the result only, and Cholesky takes
+	//over the storage of a temporary.
+	Matrix<> C = Identity(50);
+	Instrument::reset();
+	{
+		Matrix<> D = C + C.diagonal_slice().as_diagonal();
+		Cholesky<> chol(C + 0.1 * C.diagonal_slice().as_diagonal());
+	}
+	print_counts();
+
+	//Reset clears everything
+	Instrument::reset();
+	print_counts();
+	print_operation("Cholesky");
+
+	return 0;
+}
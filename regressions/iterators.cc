@@ -0,0 +1,56 @@
+#include "regressions/regression.h"
+#include <algorithm>
+#include <numeric>
+
+template<class It> void print_category(It)
+{
+	cout << (typeid(typename std::iterator_traits<It>::iterator_category) == typeid(std::random_access_iterator_tag)) << endl;
+}
+
+int main()
+{
+	Vector<5> v = makeVector(3, 1, 4, 1, 5);
+	Vector<> w = makeVector(9, 2, 6, 5, 3, 5);
+	Matrix<3> m = Data(1, 2, 3,
+	                   4, 5, 6,
+	                   7, 8, 9);
+
+	//Unit stride vectors are iterated with pointers
+	cout << (v.begin() == &v[0]) << " " << (w.end() - w.begin()) << endl;
+	cout << std::accumulate(v.begin(), v.end(), 0.0) << endl;
+	std::sort(w.begin(), w.end());
+	cout << w << endl;
+
+	double total = 0;
+	for(double x: v)
+		total += x;
+	cout << total << endl;
+
+	//Strided slices: columns and the diagonal
+	print_category(m.T()[1].begin());
+	cout << std::accumulate(m.T()[1].begin(), m.T()[1].end(), 0.0) << endl;
+	cout << std::inner_product(m[0].begin(), m[0].end(), m.T()[2].begin(), 0.0) << endl;
+	cout << *std::max_element(m.diagonal_slice().begin(), m.diagonal_slice().end()) << endl;
+
+	Vector<3, double, Internal::SliceVBase<3> > c = m.T()[0];
+	std::reverse(c.begin(), c.end());
+	cout << m << endl;
+	std::transform(c.begin(), c.end(), c.begin(), [](double x){ return -x; });
+	cout << m.T()[0] << endl;
+
+	//Random access on a dynamic stride
+	Vector<> wide = makeVector(1, 2, 3, 4, 5, 6, 7, 8);
+	Vector<Dynamic, double, Internal::SliceVBase<Dynamic> > s = wrapVector(&wide[1], 4, 2);
+	cout << s.end() - s.begin() << " " << s.begin()[3] << " " << *(s.end() - 1) << " " << *(2 + s.begin()) << endl;
+	cout << (s.begin() < s.end()) << " " << (s.end() - 4 == s.begin()) << endl;
+	cout << std::count(w.begin(), w.end(), 5.0) << endl;
+
+	//Reverse and const iteration
+	const Vector<5> cv = v;
+	std::copy(cv.rbegin(), cv.rend(), v.begin());
+	cout << v << endl;
+	Vector<Dynamic, double, Internal::SliceVBase<Dynamic> >::const_iterator ci = s.begin();
+	cout << *ci << " " << *s.crbegin() << endl;
+
+	return 0;
+}
@@ -26,4 +26,6 @@ int main()
 
 	test<Dynamic>(m);
 	test<10>(m);
+
+	return 0;
 }
@@ -0,0 +1,56 @@
+#include "regressions/regression.h"
+#include <typeinfo>
+
+template<int S, class P, class B> void print_type(const Vector<S, P, B>& v)
+{
+	cout << S << " " << (typeid(P) == typeid(double)) << (typeid(P) == typeid(float)) << (typeid(P) == typeid(int)) << " " << v << endl;
+}
+
+int main()
+{
+	//The precision is the type of the arguments if they all match, and double otherwise
+	print_type(makeVector(1.5));
+	print_type(makeVector(1, 2, 3));
+	print_type(makeVector(1, 2.5, 3));
+	print_type(makeVector(1.f, 2.f));
+	print_type(makeVector(1.f, 2));
+	const double c = 4;
+	double d = 5;
+	print_type(makeVector(c, d));
+
+	//Or it can be given explicitly
+	print_type(makeVector<float>(1, 2.5));
+	print_type(makeVector<int>(3));
+	cout << Matrix<2, 2, float>(Data<float>(1, 2, 3, 4.5)) << endl;
+
+	Vector<2, std::complex<double> > z = makeVector(std::complex<double>(1, 2), std::complex<double>(3, 4));
+	cout << z << endl;
+
+	//There is no limit on the number of arguments
+	Vector<40> v = makeVector(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+	                          21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40.5);
+	cout << v << endl;
+
+	Matrix<2, 3> m = Data(1, 2.5, 3, 4, 5, 6);
+	cout << m << endl;
+	Matrix<2, 2, float> f = Data(1.f, 2.f, 3.f, 4.f);
+	cout << f << endl;
+	Vector<3> w = Data(7, 8, 9);
+	cout << w << endl;
+
+	Matrix<11> big = Data(
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2);
+	cout << norm_fro(big - Matrix<11>(Identity)) << endl;
+
+	return 0;
+}
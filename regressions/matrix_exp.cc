@@ -0,0 +1,57 @@
+#include "regressions/regression.h"
+#include <TooN/so3.h>
+#include <TooN/gaussian_elimination.h>
+
+int main()
+{
+	cout << setprecision(10);
+
+	//Each Pade order and the scaling are selected by the norm. Rotations
+	//about an axis check the result against the closed form.
+	MatrixExponential<3> e;
+	const double angles[] = {1e-3, 0.1, 0.5, 1.5, 3.0, 20.0, 100.0};
+	for(double t: angles) {
+		const Vector<3> w = makeVector(0.3, -0.5, 0.8) * t;
+		Matrix<3> a = SO3<>::generator(0) * w[0] + SO3<>::generator(1) * w[1] + SO3<>::generator(2) * w[2];
+		e.compute(a);
+		cout << t << " " << e.get_order() << " " << e.get_squarings() << " " << (norm_inf(e.get_exp() - SO3<>::exp(w).get_matrix()) < 1e-13) << endl;
+	}
+
+	//A general matrix
+	cout << exp(Matrix<2>(Data(1, 2, 3, 4))) << endl;
+
+	//Nilpotent and diagonal matrices
+	cout << exp(Matrix<2>(Data(0, 1, 0, 0))) << endl;
+	Matrix<3> d = Zeros;
+	d(0,0) = 1;
+	d(1,1) = -2;
+	d(2,2) = 0.5;
+	Matrix<3> ed = exp(d);
+	cout << (std::abs(ed(0,0) - std::exp(1.)) < 1e-15) << (std::abs(ed(1,1) - std::exp(-2.)) < 1e-15) << (std::abs(ed(2,2) - std::exp(0.5)) < 1e-15) << endl;
+
+	//The dynamic workspace is reused, and exp(A) exp(-A) = I
+	MatrixExponential<> de(5);
+	for(int i=0; i < 3; i++) {
+		Matrix<> a(5, 5);
+		for(int r=0; r < 5; r++)
+			for(int c=0; c < 5; c++)
+				a(r,c) = xor128d() * (i + 1);
+		const Matrix<> I = Identity(5);
+		const Matrix<> ea = de.compute(a);
+		Matrix<> p = ea * de.compute(-a);
+		cout << de.get_order() << " " << (norm_inf(p - I) < 1e-10) << endl;
+	}
+
+	//Single precision
+	Matrix<2, 2, float> f = exp(Matrix<2, 2, float>(Data(0.f, -1.f, 1.f, 0.f)));
+	cout << (std::abs(f(0,0) - std::cos(1.f)) < 1e-6f) << (std::abs(f(1,0) - std::sin(1.f)) < 1e-6f) << endl;
+
+	//In place elimination matches the copying version
+	Matrix<3> A = Data(2, 1, 0, 1, 3, 1, 0, 1, 4);
+	Matrix<3, 2> B = Data(1, 2, 3, 4, 5, 6);
+	Matrix<3, 2> X = gaussian_elimination(A, B);
+	gaussian_elimination_in_place(A, B);
+	cout << X << B << endl;
+
+	return 0;
+}
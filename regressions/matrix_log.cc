@@ -0,0 +1,41 @@
+#include "regressions/regression.h"
+#include <TooN/so3.h>
+#include <TooN/sl.h>
+
+int main()
+{
+	cout << setprecision(10);
+
+	//Rotations: the log is the generator, up to angles close to pi
+	const double angles[] = {1e-3, 0.1, 0.5, 1.5, 3.0};
+	for(double t: angles) {
+		const Vector<3> w = makeVector(0.3, -0.5, 0.8) * t;
+		const Matrix<3> a = SO3<>::generator(0) * w[0] + SO3<>::generator(1) * w[1] + SO3<>::generator(2) * w[2];
+		cout << t << " " << (norm_inf(log(SO3<>::exp(w).get_matrix()) - a) < 1e-13) << endl;
+	}
+
+	//Round trips through the exponential
+	const Vector<8> h = makeVector(0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8);
+	cout << (norm_inf(SL<3>::exp(h).ln() - h) < 1e-13) << endl;
+
+	Matrix<> a(4, 4);
+	for(int r=0; r < 4; r++)
+		for(int c=0; c < 4; c++)
+			a(r,c) = xor128d();
+	cout << (norm_inf(log(exp(a)) - a) < 1e-12) << endl;
+
+	//Square roots
+	Matrix<2> t = Data(4, 1, 0, 9);
+	cout << sqrt(t) << endl;
+	Matrix<3> s = Data(5, 1, 0, 1, 4, 1, 0, 1, 3);
+	Matrix<3> root = sqrt(s);
+	cout << (norm_inf(root * root - s) < 1e-13) << endl;
+	Matrix<> droot = sqrt(a * a.T());
+	cout << (norm_inf(droot * droot - a * a.T()) < 1e-12) << endl;
+
+	//Logs of diagonal matrices
+	Matrix<2> d = Data(2, 0, 0, 0.5);
+	cout << log(d) << endl;
+
+	return 0;
+}
@@ -0,0 +1,113 @@
+#define TOON_INSTRUMENT
+#include "regressions/regression.h"
+
+void print_counts()
+{
+	const Instrument::Report& r = Instrument::report();
+	cout << r.allocations << " " << r.copies << endl;
+	Instrument::reset();
+}
+
+template<class M> M make(int n)
+{
+	M m = Identity(n);
+	m(0, n-1) = n;
+	return m;
+}
+
+Vector<Resizable> make_resizable(int n)
+{
+	Vector<Resizable> v(n);
+	for(int i=0; i < n; i++)
+		v[i] = i;
+	return v;
+}
+
+int main()
+{
+	//Dynamic matrices
+	Matrix<> a = make<Matrix<> >(3);
+	Instrument::reset();
+	Matrix<> b = std::move(a);
+	print_counts();
+	cout << b << endl;
+
+	Matrix<> c = Zeros(3, 3);
+	Instrument::reset();
+	c = std::move(b);
+	print_counts();
+	cout << c << b << endl;
+
+	//Large statically sized matrices are on the heap
+	Matrix<20> d = make<Matrix<20> >(20);
+	Instrument::reset();
+	Matrix<20> e = std::move(d);
+	print_counts();
+
+	Matrix<20> f = Zeros;
+	Instrument::reset();
+	f = std::move(e);
+	print_counts();
+	cout << f(0, 19) << " " << e(0, 19) << endl;
+
+	//Small ones are on the stack and are copied.
+	Matrix<2> g = Identity;
+	Instrument::reset();
+	Matrix<2> h = std::move(g);
+	print_counts();
+	cout << h << endl;
+
+	//Vectors
+	Vector<> u = makeVector(1, 2, 3);
+	Vector<> w = Zeros(3);
+	Instrument::reset();
+	w = std::move(u);
+	print_counts();
+	cout << w << u << endl;
+
+	Vector<Resizable> r;
+	Instrument::reset();
+	r = make_resizable(4);
+	print_counts();
+	cout << r << endl;
+
+	//A moved from object can be assigned to again
+	Vector<> x = makeVector(1, 2, 3);
+	Vector<> y = std::move(x);
+	cout << x.size() << " ";
+	x = y;
+	x[0] = 4;
+	cout << x << y << endl;
+	Vector<> z = std::move(x);
+	x = z + y;
+	cout << x << endl;
+
+	Matrix<> p = Identity(3);
+	Matrix<> q = std::move(p);
+	cout << p.num_rows() << " " << p.num_cols() << endl;
+	p = q;
+	p(0, 2) = 2;
+	cout << p << q << endl;
+
+	Matrix<3, Dynamic> s = Zeros(3, 2);
+	Matrix<3, Dynamic> t = std::move(s);
+	s = Matrix<3, Dynamic>(Ones(3, 4));
+	cout << s.num_rows() << " " << s.num_cols() << " " << s(2, 3) << endl;
+
+	Matrix<20> big = make<Matrix<20> >(20);
+	Matrix<20> big2 = std::move(big);
+	big = big2;
+	cout << big(0, 19) << " ";
+	Matrix<20> big3 = std::move(big);
+	big = Zeros;
+	cout << big(0, 19) << endl;
+
+	//Slices can not steal data, so the data is copied into the original.
+	Matrix<3> m = Zeros;
+	Matrix<3> n = Identity;
+	m.slice<0, 0, 2, 2>() = n.slice<1, 1, 2, 2>();
+	m[2] = n[0];
+	cout << m << endl;
+
+	return 0;
+}
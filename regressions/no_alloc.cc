@@ -0,0 +1,91 @@
+#define TOON_TEST_INTERNALS
+#include "regressions/regression.h"
+
+typedef Vector<Dynamic, double, Bounded<6> > BVector;
+
+template<class F> void expect_heap_error(F f)
+{
+	try
+	{
+		f();
+		cout << "no error" << endl;
+	}
+	catch(Internal::HeapAllocation)
+	{
+		cout << "heap allocation" << endl;
+	}
+}
+
+int main()
+{
+	Vector<> d = makeVector(1, 2, 3);
+
+	{
+		NoAllocGuard no_alloc;
+
+		//Static and bounded vectors never allocate
+		Vector<3> s = makeVector(1, 2, 3);
+		BVector b(3);
+		b = s;
+		b += d;
+		b *= 2;
+		cout << b << endl;
+
+		b.resize(5);
+		b.slice(3, 2) = makeVector(10, 20);
+		cout << b << endl;
+		cout << b.size() << " " << BVector::capacity() << endl;
+
+		//Bounded vectors are resized on assignment.
+		b = d.slice(0, 2);
+		cout << b << endl;
+
+		Matrix<3> m = Identity;
+		cout << m * s << endl;
+
+		//Dynamic objects do
+		expect_heap_error([&]{ Vector<> v(3); });
+		expect_heap_error([&]{ Vector<> v = d; });
+		expect_heap_error([&]{ Matrix<> m(2, 2); });
+		expect_heap_error([&]{ Vector<Resizable> v; v.resize(3); });
+		expect_heap_error([&]{ Matrix<200> m; });
+
+		//Guards nest
+		{
+			NoAllocGuard inner;
+		}
+		expect_heap_error([&]{ Vector<> v(3); });
+	}
+
+	//Outside of the guard, allocation is fine.
+	expect_heap_error([&]{ Vector<> v(3); });
+
+	//Capacity errors
+	BVector b;
+	cout << b.size() << endl;
+	try
+	{
+		b.resize(7);
+	}
+	catch(Internal::BoundedOverflow)
+	{
+		cout << "overflow" << endl;
+	}
+
+	try
+	{
+		b = Vector<7>(Zeros);
+	}
+	catch(Internal::BoundedOverflow)
+	{
+		cout << "overflow" << endl;
+	}
+
+	//Copies are independent
+	BVector c = makeVector(4, 5, 6, 7);
+	BVector e = c;
+	c[0] = 0;
+	cout << c << endl << e << endl;
+
+	return 0;
+}
@@ -69,5 +69,7 @@ int main()
 	
 	test<QR<> >();
 	test<QR_Lapack<> >();
+
+	return 0;
 }
 
@@ -51,6 +51,8 @@ int main()
 
 	cout << dh_variable.get_simplex()[dh_variable.get_best()] << endl
 	     << dh_variable.get_values()[dh_variable.get_best()] << endl;
+
+	return 0;
 }
 
 
@@ -0,0 +1,61 @@
+#include "regressions/regression.h"
+#include <TooN/sl.h>
+
+template<int N> Matrix<N> generator_sum(const Vector<N*N-1>& v)
+{
+	Matrix<N> m = Zeros;
+	for(int i=0; i < N*N-1; i++)
+		m += SL<N>::generator(i) * v[i];
+	return m;
+}
+
+template<int N> void test(const Vector<N*N-1>& v)
+{
+	//The algebra is built directly, and exp and ln are inverses
+	cout << (norm_inf(SL<N>::algebra(v) - generator_sum<N>(v)) == 0) << " ";
+	const SL<N> h = SL<N>::exp(v);
+	cout << (norm_inf(h.get_matrix() - exp(generator_sum<N>(v))) < 1e-12) << " ";
+	cout << (norm_inf(h.ln() - v) < 1e-12) << " ";
+
+	//Generator fields match the generators
+	const Vector<N> p = makeVector(0.3, -0.2, 1.1).template slice<0, N>();
+	double field = 0;
+	for(int i=0; i < N*N-1; i++)
+		field = max(field, norm_inf(SL<N>::generator_field(i, p) - SL<N>::generator(i) * p));
+	cout << (field == 0) << " ";
+
+	//The point Jacobian matches finite differences
+	const Vector<N-1> x = makeVector(0.4, -0.7).template slice<0, N-1>();
+	const Matrix<N-1, N*N-1> J = h.point_jacobian(x);
+	Matrix<N-1, N*N-1> numerical;
+	const double delta = 1e-6;
+	for(int i=0; i < N*N-1; i++) {
+		Vector<N*N-1> d = Zeros;
+		d[i] = delta;
+		Vector<N> hx = unproject(x);
+		Vector<N> plus = SL<N>::exp(d) * h * hx;
+		Vector<N> minus = SL<N>::exp(-d) * h * hx;
+		numerical.T()[i] = (project(plus) - project(minus)) / (2 * delta);
+	}
+	cout << (norm_inf(J - numerical) < 1e-8) << endl;
+}
+
+int main()
+{
+	//SL<2>: elliptic, hyperbolic, parabolic and tiny algebra elements
+	test<2>(makeVector(0.1, 0.2, 0.9));
+	test<2>(makeVector(0.5, 0.8, -0.3));
+	test<2>(makeVector(0.0, 0.4, 0.4));
+	test<2>(makeVector(1e-5, -2e-5, 3e-5));
+	test<2>(makeVector(0.3, 0.1, 2.5));
+
+	test<3>(makeVector(0.1, -0.2, 0.3, 0.05, -0.1, 0.2, 0.3, -0.1));
+	test<3>(makeVector(1e-4, 2e-4, -1e-4, 0, 1e-4, 0, 0, 3e-4));
+	//Large enough for squarings in exp and several square roots in ln
+	test<3>(makeVector(0.8, -0.5, 1.2, 0.4, -0.9, 0.6, 1.5, -0.7));
+
+	//The closed form for SL<2>
+	cout << setprecision(10) << SL<2>::exp(makeVector(0.1, 0.2, 0.9)) << endl;
+
+	return 0;
+}
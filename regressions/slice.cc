@@ -17,4 +17,6 @@ int main()
 	const Vector<4> cv = makeVector(3,4,5,6);
 	cout << cv.slice<0,2>() << endl;
 	cout << cv.slice(0,2) << endl;
+
+	return 0;
 }
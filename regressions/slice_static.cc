@@ -0,0 +1,34 @@
+#include "regressions/regression.h"
+
+template<int S, class P, class B> int static_size(const Vector<S, P, B>&)
+{
+	return S;
+}
+
+template<int R, int C, class P, class B> int static_size(const Matrix<R, C, P, B>&)
+{
+	return R * 10 + C;
+}
+
+int main()
+{
+	Vector<5> v = makeVector(1, 2, 3, 4, 5);
+	Matrix<3> m = Data(1, 2, 3, 4, 5, 6, 7, 8, 9);
+	const Matrix<3> n = m;
+	const Vector<4> cv = makeVector(3,4,5,6);
+
+	//Static size at a run-time position
+	int start = 1;
+	cout << static_size(cv.slice<2>(start)) << " " << cv.slice<2>(start) << endl;
+	v.slice<3>(start) = makeVector(7, 8, 9);
+	cout << v << endl;
+
+	Matrix<> d = m;
+	cout << static_size(d.slice<2,2>(start, start)) << endl;
+	d.slice<2,2>(start, start) *= 10;
+	cout << d << endl;
+	cout << n.slice<1,3>(start, 0) << endl;
+	cout << d.T().slice<2,1>(0, start) << endl;
+
+	return 0;
+}
@@ -16,4 +16,5 @@ int main()
 
 	cout << SO3<>::exp(u.as_slice());
 
+	return 0;
 }
@@ -0,0 +1,90 @@
+#include "regressions/regression.h"
+#include <TooN/sparse.h>
+#include <TooN/Cholesky.h>
+
+bool small(double x)
+{
+	return x < 1e-9;
+}
+
+int main()
+{
+	//Duplicates are summed and rows are sorted
+	std::vector<SparseEntry<> > e;
+	e.push_back({0, 2, 1});
+	e.push_back({0, 0, 2});
+	e.push_back({2, 1, 3});
+	e.push_back({0, 2, 4});
+	e.push_back({3, 3, -1});
+	SparseMatrix<> S(4, 5, e);
+	cout << S.num_nonzeros() << endl;
+	cout << S.dense() << endl;
+	cout << S.T().dense() << endl;
+	cout << S(0, 2) << " " << S(1, 1) << endl;
+
+	//A Jacobian with a few entries per row
+	const int rows = 60, cols = 25;
+	std::vector<SparseEntry<> > je;
+	for(int r=0; r < rows; r++)
+		for(int k=0; k < 3; k++)
+			je.push_back({r, (r*7 + k*11) % cols, 1.0 + ((r*13 + k*5) % 17) / 4.0});
+	SparseMatrix<> J(rows, cols, je);
+	Matrix<> Jd = J.dense();
+
+	Vector<> x(cols), y(rows);
+	for(int i=0; i < cols; i++)
+		x[i] = (i*i % 9) - 4;
+	for(int i=0; i < rows; i++)
+		y[i] = (i % 5) * 0.5 - 1;
+
+	cout << small(norm_inf(J * x - Jd * x)) << endl;
+	cout << small(norm_inf(y * J - y * Jd)) << endl;
+	cout << small(norm_fro(JtJ(J).dense() - Jd.T() * Jd)) << endl;
+	cout << small(norm_fro(SparseMatrix<>(Jd).dense() - Jd)) << endl;
+
+	//Sparse solve agrees with the dense one
+	SparseMatrix<> A = JtJ(J);
+	Cholesky<> dchol(A.dense());
+	SparseCholesky<> chol(A);
+	cout << chol.rank() << endl;
+	cout << small(norm_inf(chol.backsub(x) - dchol.backsub(x))) << endl;
+	cout << small(std::abs(chol.determinant() - dchol.determinant()) / dchol.determinant()) << endl;
+
+	//Reuse the symbolic analysis with new values
+	for(size_t i=0; i < A.values().size(); i++)
+		A.values()[i] *= 2;
+	chol.factorize(A);
+	cout << small(norm_inf(2 * chol.backsub(x) - dchol.backsub(x))) << endl;
+
+	//A 2D Laplacian, where the ordering reduces the fill in
+	const int g = 30, n = g*g;
+	std::vector<SparseEntry<> > le;
+	for(int r=0; r < g; r++)
+		for(int c=0; c < g; c++)
+		{
+			const int i = r*g + c;
+			le.push_back({i, i, 4.5});
+			if(r > 0) le.push_back({i, i-g, -1});
+			if(r < g-1) le.push_back({i, i+g, -1});
+			if(c > 0) le.push_back({i, i-1, -1});
+			if(c < g-1) le.push_back({i, i+1, -1});
+		}
+	SparseMatrix<> L(n, n, le);
+	Vector<> b(n);
+	for(int i=0; i < n; i++)
+		b[i] = (i % 7) - 3;
+
+	SparseCholesky<> lchol(L);
+	cout << small(norm_inf(L * lchol.backsub(b) - b)) << endl;
+
+	std::vector<int> natural(n);
+	for(int i=0; i < n; i++)
+		natural[i] = i;
+	SparseCholesky<> nchol;
+	nchol.analyze(L, natural);
+	nchol.factorize(L);
+	cout << small(norm_inf(L * nchol.backsub(b) - b)) << endl;
+	cout << (lchol.num_nonzeros() < nchol.num_nonzeros()) << endl;
+
+	return 0;
+}
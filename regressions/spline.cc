@@ -0,0 +1,108 @@
+#include "regressions/regression.h"
+#include <TooN/spline.h>
+
+template<class Group> double distance(const Group& a, const Group& b)
+{
+	return norm_inf((a.inverse() * b).ln());
+}
+
+template<class Group> void test(double scale)
+{
+	static const int dim = CumulativeSpline<Group>::dim;
+
+	//Control poses on a non-uniform path. The large scale exercises
+	//the exponential rather than the series for the Jacobians
+	CumulativeSpline<Group> spline(0.5, 0.1);
+	for(int k=0; k < 7; k++) {
+		Vector<dim> v;
+		for(int i=0; i < dim; i++)
+			v[i] = scale * (0.1 * sin(0.7 * k * (i+1) + i) + 0.05 * k);
+		spline.push_back(Group::exp(v));
+	}
+
+	//Constant control poses give a constant trajectory
+	CumulativeSpline<Group> still(0, 1);
+	for(int k=0; k < 4; k++)
+		still.push_back(spline.get_control(2));
+	cout << (distance(still.pose(0.3), spline.get_control(2)) < 1e-12) << " ";
+	cout << (norm_inf(still.velocity(0.3)) < 1e-12) << " ";
+
+	//Velocity and acceleration match finite differences
+	const double t = 0.67, h = 1e-5;
+	Group p;
+	Vector<dim> v, a;
+	spline.evaluate(t, p, v, a);
+	cout << (distance(p, spline.pose(t)) < 1e-12) << " ";
+	const Vector<dim> numerical_v = ((p.inverse() * spline.pose(t + h)).ln() - (p.inverse() * spline.pose(t - h)).ln()) / (2*h);
+	cout << (norm_inf(v - numerical_v) < 1e-6) << " ";
+	const Vector<dim> numerical_a = (spline.velocity(t + h) - spline.velocity(t - h)) / (2*h);
+	cout << (norm_inf(a - numerical_a) < 1e-4) << " ";
+
+	//The trajectory is smooth across a knot
+	const double knot = 0.5 + 2 * 0.1, e = 1e-9;
+	cout << (spline.segment(knot - e) + 1 == spline.segment(knot + e)) << " ";
+	cout << (distance(spline.pose(knot - e), spline.pose(knot + e)) < 1e-7) << " ";
+	cout << (norm_inf(spline.velocity(knot - e) - spline.velocity(knot + e)) < 1e-6) << " ";
+	cout << (norm_inf(spline.acceleration(knot - e) - spline.acceleration(knot + e)) < 1e-4) << " ";
+
+	//Batched evaluation matches single evaluation
+	Vector<5> times = makeVector(0.5, 0.55, 0.61, 0.73, 0.8);
+	std::vector<Group> poses;
+	spline.evaluate(times, poses);
+	double batched = 0;
+	for(int i=0; i < times.size(); i++)
+		batched = max(batched, distance(poses[i], spline.pose(times[i])));
+	cout << (poses.size() == 5 && batched < 1e-12) << " ";
+
+	//The control pose Jacobian matches finite differences
+	const int first = spline.segment(t);
+	const Matrix<dim, 4*dim> J = spline.pose_jacobian(t);
+	Matrix<dim, 4*dim> numerical;
+	for(int m=0; m < 4; m++)
+		for(int i=0; i < dim; i++) {
+			Vector<dim> d = Zeros;
+			d[i] = h;
+			CumulativeSpline<Group> plus = spline, minus = spline;
+			plus.set_control(first + m, spline.get_control(first + m) * Group::exp(d));
+			minus.set_control(first + m, spline.get_control(first + m) * Group::exp(-d));
+			numerical.T()[m*dim + i] = ((p.inverse() * plus.pose(t)).ln() - (p.inverse() * minus.pose(t)).ln()) / (2*h);
+		}
+	cout << (norm_inf(J - numerical) < 1e-6) << " ";
+
+	//Geodesic interpolation
+	const Group g0 = spline.get_control(1), g1 = spline.get_control(4);
+	cout << (distance(interpolate(g0, g1, 0.0), g0) < 1e-12) << " ";
+	cout << (distance(interpolate(g0, g1, 1.0), g1) < 1e-12) << endl;
+}
+
+int main()
+{
+	test<SO3<> >(1);
+	test<SE3<> >(1);
+	test<SIM3<> >(1);
+	test<SO3<> >(6);
+	test<SE3<> >(6);
+	test<SIM3<> >(6);
+
+	//Control poses evenly spaced along a line at their times give a
+	//trajectory which moves along the line with them
+	CumulativeSpline<SE3<> > line(0, 1);
+	for(int k=0; k < 8; k++)
+		line.push_back(SE3<>(SO3<>(), makeVector(k, 0, 0)));
+	double error = 0;
+	for(double t = 1; t <= 6; t += 0.5)
+		error = max(error, norm_inf(line.pose(t).get_translation() - makeVector(t, 0, 0)));
+	cout << (line.get_start_time() == 1) << " " << (line.get_end_time() == 6) << " ";
+	cout << (line.segment(1) == 0) << " " << (line.segment(2.5) == 1) << " " << (line.segment(6) == 4) << " ";
+	cout << (error < 1e-12) << " " << (norm_inf(line.velocity(3.7) - makeVector(1, 0, 0, 0, 0, 0)) < 1e-12) << endl;
+
+	//The SIM3 adjoint transfers the algebra between frames, and
+	//trinvadjoint transfers covectors
+	const SIM3<> g = SIM3<>::exp(makeVector(0.3, -0.2, 0.5, 0.1, 0.4, -0.3, 0.2));
+	const Vector<7> v = makeVector(-0.1, 0.3, 0.2, 0.2, -0.1, 0.15, -0.25);
+	const Vector<7> w = makeVector(0.4, 0.1, -0.3, 0.2, 0.5, -0.2, 0.3);
+	cout << (distance(SIM3<>::exp(g.adjoint(v)), g * SIM3<>::exp(v) * g.inverse()) < 1e-12) << " ";
+	cout << (abs(g.trinvadjoint(w) * g.adjoint(v) - w * v) < 1e-12) << endl;
+
+	return 0;
+}
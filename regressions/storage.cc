@@ -0,0 +1,55 @@
+#define TOON_TEST_INTERNALS
+#define TOON_MAX_BYTES_ON_STACK 2048
+#define TOON_NO_HEAP_SPILL
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+
+template<class F> void expect_heap_error(F f)
+{
+	try
+	{
+		NoAllocGuard no_alloc;
+		f();
+		cout << "no error" << endl;
+	}
+	catch(Internal::HeapAllocation)
+	{
+		cout << "heap allocation" << endl;
+	}
+}
+
+int main()
+{
+	cout << Internal::max_bytes_on_stack << endl;
+
+	//15x15 now fits on the stack.
+	expect_heap_error([]{ Matrix<15> m = Identity; Matrix<15> n = m * m + m; cout << n(14, 14) << endl; });
+
+	//The Stack policy overrides the limit, including for the results of operators.
+	Matrix<20, 20, double, Stack> F = Identity;
+	Matrix<20, 20, double, Stack> Q = Identity;
+	F(0, 1) = 1;
+	Vector<20, double, Stack> v = Ones;
+
+	expect_heap_error([&]{
+		Matrix<20, 20, double, Stack> P = Identity;
+		P = F * P * F.T() + Q;
+		Vector<20, double, Stack> w = P * v - v;
+		cout << P.slice<0, 0, 3, 3>() << w.slice<0, 3>() << endl;
+
+		Cholesky<20, double, Stack> chol(P);
+		cout << (P * chol.backsub(v) - v).slice<0, 3>() << endl;
+		cout << chol.get_inverse().slice<0, 0, 2, 2>() << endl;
+	});
+
+	//The Heap policy always uses the heap.
+	expect_heap_error([]{ Matrix<2, 2, double, Heap> m = Identity; });
+	expect_heap_error([]{ Vector<2, double, Heap> v = Zeros; });
+
+	Matrix<2, 2, double, Heap> m = Data(1, 2, 3, 4);
+	Matrix<2, 2, double, Heap> n = m;
+	m(0, 0) = 0;
+	cout << m << n << m * n << endl;
+
+	return 0;
+}
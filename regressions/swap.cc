@@ -65,4 +65,6 @@ int main()
 		swap_test<257>(1);
 		swap_test<1023>(1);
 	}
+
+	return 0;
 }
@@ -52,6 +52,12 @@ template<int Size1> void test_matrix(const Matrix<Size1>& m, int& sorted, double
 	e = max(e, norm_inf(m - sm.get_evectors().T() * sm.get_evalues().as_diagonal() * sm.get_evectors())/m.num_rows());	
 	e = max(e, norm_inf(Matrix<Size1>(Identity(m.num_rows())) - sm.get_evectors().T() * sm.get_evectors())/m.num_rows());	
 
+	//The packed symmetric version must agree with the dense one
+	SymmetricMatrix<Size1> packed(m);
+	SymEigen<Size1> pm(packed);
+	e = max(e, norm_inf(pm.get_evalues() - sm.get_evalues()));
+	e = max(e, norm_inf(m - pm.get_evectors().T() * pm.get_evalues().as_diagonal() * pm.get_evectors())/m.num_rows());	
+
 
 	n = max(n, e);
 }
@@ -119,4 +125,6 @@ void test_things()
 int main()
 {
 	test_things();
+
+	return 0;
 }
@@ -0,0 +1,76 @@
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+#include <TooN/SymEigen.h>
+
+int main()
+{
+	Matrix<3> M = Data(4, 1, 2,
+	                   1, 5, 3,
+	                   2, 3, 6);
+
+	SymmetricMatrix<3> S = M;
+	cout << S.packed() << endl;
+	cout << S << endl;
+	cout << S(2, 0) << " " << S(0, 2) << endl;
+	S(2, 0) = 2.5;
+	cout << S(0, 2) << endl;
+	S(0, 2) = 2;
+
+	//Products match the dense versions
+	Vector<3> v = makeVector(1, -2, 3);
+	Matrix<3, 2> B = Data(1, 2, 3, 4, 5, 6);
+	cout << S * v << endl << M * v << endl << v * S << endl;
+	cout << S * B << endl << M * B << endl;
+	cout << B.T() * S << endl << B.T() * M << endl;
+
+	//Symmetric updates
+	Matrix<4, 3> J = Data(1, 2, 0,
+	                      0, 1, 1,
+	                      2, 0, 1,
+	                      1, 1, 1);
+	cout << JtJ(J).dense() - J.T() * J << endl;
+
+	Vector<4> w = makeVector(1, 2, 3, 4);
+	cout << JtWJ(J, w.as_diagonal()).dense() - J.T() * w.as_diagonal() * J << endl;
+
+	Matrix<4> W = Data(2, 1, 0, 0,
+	                   1, 2, 1, 0,
+	                   0, 1, 2, 1,
+	                   0, 0, 1, 2);
+	cout << JtWJ(J, SymmetricMatrix<4>(W)).dense() - J.T() * W * J << endl;
+
+	SymmetricMatrix<3> A = Identity;
+	for(int i=0; i < J.num_rows(); i++)
+		A.add_outer(J[i], 2);
+	cout << A.dense() - (Matrix<3>(Identity) + 2 * J.T() * J) << endl;
+
+	A += S;
+	A -= S;
+	A *= 2;
+	cout << (A + S).dense() - (A.dense() + M) << endl;
+	cout << (A - S).dense() - (A.dense() - M) << endl;
+
+	//Dynamic
+	SymmetricMatrix<> D = Zeros(3);
+	D.add_JtJ(J);
+	cout << D.size() << " " << D.packed().size() << endl;
+	cout << D.dense() - J.T() * J << endl;
+	SymmetricMatrix<> I = Identity(2);
+	cout << I << endl;
+
+	//Decompositions
+	Cholesky<3> chol(S);
+	Cholesky<3> dchol(M);
+	cout << chol.get_inverse() - dchol.get_inverse() << endl;
+	cout << chol.backsub(v) - dchol.backsub(v) << endl;
+
+	Cholesky<> chol2(3);
+	chol2.compute(D + SymmetricMatrix<>(Identity(3)));
+	cout << chol2.get_inverse() * (D.dense() + Identity(3)) << endl;
+
+	SymEigen<3> eig(S);
+	SymEigen<3> deig(M);
+	cout << eig.get_evalues() - deig.get_evalues() << endl;
+
+	return 0;
+}
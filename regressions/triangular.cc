@@ -0,0 +1,65 @@
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+#include <TooN/QR.h>
+
+bool small(double x)
+{
+	return x < 1e-10;
+}
+
+template<class T> void test_view(const T& t)
+{
+	Matrix<4> D = t.dense();
+	Vector<4> v = makeVector(1, -2, 3, 0.5);
+	Matrix<4, 2> B = Data(1, 2,
+	                      -1, 0,
+	                      3, 1,
+	                      2, -2);
+
+	cout << t << endl;
+	cout << small(norm_inf(t * v - D * v)) << " " << small(norm_inf(v * t - v * D)) << endl;
+	cout << small(norm_fro(t * B - D * B)) << " " << small(norm_fro(B.T() * t - B.T() * D)) << endl;
+	cout << small(norm_inf(D * solve(t, v) - v)) << " " << small(norm_fro(D * solve(t, B) - B)) << endl;
+	cout << small(norm_inf(t.T() * v - D.T() * v)) << " " << small(norm_inf(D.T() * solve(t.T(), v) - v)) << endl;
+}
+
+int main()
+{
+	//The values outside the triangle must never be used.
+	Matrix<4> M = Data(4, 1, 2, 3,
+	                   1, 5, 3, 1,
+	                   2, 3, 6, 2,
+	                   3, 1, 2, 7);
+
+	test_view(upper_triangular(M));
+	test_view(lower_triangular(M));
+	test_view(unit_upper_triangular(M));
+	test_view(unit_lower_triangular(M));
+
+	//Dynamic and column major storage
+	Matrix<Dynamic, Dynamic, double, ColMajor> C = M;
+	test_view(upper_triangular(C));
+	test_view(lower_triangular(C.slice(0, 0, 4, 4)));
+
+	//Whitening with the Cholesky factor: L^-1 C L^-T = I
+	Matrix<4> S = M * M.T() + Matrix<4>(Identity);
+	Cholesky<4> chol(S);
+	Matrix<4> L = chol.get_L();
+	cout << small(norm_fro(solve(lower_triangular(L), solve(lower_triangular(L), S).T()) - Matrix<4>(Identity))) << endl;
+	cout << small(norm_fro(lower_triangular(L) * lower_triangular(L).T().dense() - S)) << endl;
+
+	//The R of a QR decomposition of a wide matrix
+	Matrix<4, 6> A = Data(1, 2, 3, 4, 1, 0,
+	                      2, 1, 0, 1, 1, 2,
+	                      0, 1, 3, 1, 1, 1,
+	                      5, 2, 1, 0, 1, 3);
+	QR<4, 6> qr(A);
+	cout << upper_triangular(qr.get_R()).size() << endl;
+	cout << small(norm_fro(qr.get_Q() * upper_triangular(qr.get_R()).dense() - A.slice<0,0,4,4>())) << endl;
+	cout << small(norm_inf(qr.get_Q() * (upper_triangular(qr.get_R()) * makeVector(1., 2, 3, 4)) - A.slice<0,0,4,4>() * makeVector(1., 2, 3, 4))) << endl;
+
+	Matrix<> Md = M;
+	cout << lower_triangular(Md.slice(1, 0, 3, 4)).size() << endl;
+
+	return 0;
+}
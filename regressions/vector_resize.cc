@@ -36,5 +36,5 @@ int main()
 
 	cout << r << endl;
 
-
+	return 0;
 }
@@ -0,0 +1,82 @@
+#include <TooN/wls.h>
+#include <TooN/gaussian_elimination.h>
+#include <iomanip>
+#include "regressions/regression.h"
+
+template<int Size> void test(int size, int measurements)
+{
+	WLS<Size> wls(size);
+	Matrix<Size> C_inv = Zeros(size);
+	Vector<Size> v = Zeros(size);
+
+	wls.add_prior(1);
+	C_inv = Identity(size);
+
+	//Single measurements
+	for(int i=0; i < measurements; i++)
+	{
+		Vector<Size> J(size);
+		for(int j=0; j < size; j++)
+			J[j] = xor128d() - 0.5;
+		double m = xor128d();
+		double w = xor128d() + 0.5;
+
+		wls.add_mJ(m, J, w);
+		C_inv += w * J.as_col() * J.as_row();
+		v += w * m * J;
+	}
+
+	//Blocks of two measurements
+	for(int i=0; i < measurements/2; i++)
+	{
+		Matrix<2, Size> J(2, size);
+		for(int r=0; r < 2; r++)
+			for(int c=0; c < size; c++)
+				J[r][c] = xor128d() - 0.5;
+		Vector<2> m = makeVector(xor128d(), xor128d());
+		Matrix<2> W = Data(2, 0.5, 0.5, 1);
+
+		wls.add_mJ_rows(m, J, W);
+		C_inv += J.T() * W * J;
+		v += J.T() * W * m;
+	}
+
+	//Sparse blocks
+	for(int i=0; i < measurements/2; i++)
+	{
+		Matrix<2, 3> J1, J2;
+		for(int r=0; r < 2; r++)
+			for(int c=0; c < 3; c++)
+			{
+				J1[r][c] = xor128d() - 0.5;
+				J2[r][c] = xor128d() - 0.5;
+			}
+		Vector<2> m = makeVector(xor128d(), xor128d());
+		Matrix<2> W = Identity;
+
+		wls.add_sparse_mJ_rows(m, J1, 0, J2, size-3, W);
+
+		Matrix<2, Size> J = Zeros(2, size);
+		J.slice(0, 0, 2, 3) = J1;
+		J.slice(0, size-3, 2, 3) += J2;
+		C_inv += J.T() * W * J;
+		v += J.T() * W * m;
+	}
+
+	wls.compute();
+
+	Vector<Size> mu = gaussian_elimination(C_inv, v);
+
+	cout << wls.get_mu() << endl;
+	cout << norm_inf(wls.get_mu() - mu) << endl;
+}
+
+int main()
+{
+	cout << setprecision(10);
+	test<6>(6, 2000);
+	test<Dynamic>(6, 2000);
+	test<Dynamic>(20, 2000);
+
+	return 0;
+}
@@ -0,0 +1,52 @@
+#include "regressions/regression.h"
+#include <TooN/Cholesky.h>
+
+int main()
+{
+	//Interleaved points: x, y, z, intensity
+	double points[4*4];
+	for(int i=0; i < 4; i++)
+	{
+		points[i*4+0] = i;
+		points[i*4+1] = 10+i;
+		points[i*4+2] = 20+i;
+		points[i*4+3] = 0.5*i;
+	}
+
+	Vector<> intensity = wrapVector(points + 3, 4, 4);
+	cout << intensity << endl;
+
+	cout << wrapMatrix<Dynamic, 3>(points, 4, 3, 4, 1) << endl;
+	cout << wrapMatrix<Dynamic, 3>(points, 4, 3, 4, 1) * makeVector(1, 0, 1) << endl;
+
+	//Writes go through to the data
+	wrapVector<4>(points + 3, 4, 4) *= 2;
+	wrapMatrix(points, 4, 3, 4, 1).slice(1, 0, 2, 3) = Zeros;
+	for(int i=0; i < 16; i++)
+		cout << points[i] << " ";
+	cout << endl;
+
+	//A window in a padded image
+	double image[5*8];
+	for(int i=0; i < 40; i++)
+		image[i] = i;
+
+	const double* cimage = image;
+	Matrix<2, 3, const double, Internal::Slice<Dynamic, Dynamic> > window = wrapMatrix<2, 3>(cimage + 8 + 2, 2, 3, 8, 1);
+	cout << window << endl << window.T() << endl;
+	cout << window[1] << endl << window.T()[1] << endl;
+	cout << window.rowstride() << " " << window.colstride() << endl;
+
+	//Column major data with an element stride
+	double cm[] = {4, -1, 2, -1, 6, 0, 2, 0, 5, -1, -1, -1};
+	Matrix<3, 3, double, Internal::Slice<Dynamic, Dynamic> > a = wrapMatrix<3, 3>(cm, 3, 3, 1, 3);
+	Cholesky<3> chol(a);
+	cout << chol.get_inverse() * a << endl;
+	cout << a * a.T() - a.T() * a << endl;
+
+	Vector<3> b = wrapVector(cm, 3, 4);
+	cout << b << endl;
+	cout << b + wrapVector<3>(cm + 1, 3, 4) << endl;
+
+	return 0;
+}
@@ -25,4 +25,6 @@ int main()
 	cout << (m3 != Zeros) << endl;
 	m3 = Ones;
 	cout << (m3 != Zeros) << endl;
+
+	return 0;
 }
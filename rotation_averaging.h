@@ -0,0 +1,267 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_INCLUDE_ROTATION_AVERAGING_H
+#define TOON_INCLUDE_ROTATION_AVERAGING_H
+
+#include <TooN/so3.h>
+#include <TooN/se3.h>
+#include <TooN/GR_SVD.h>
+#include <TooN/sparse.h>
+#include <vector>
+#include <iterator>
+#include <limits>
+#include <cmath>
+
+namespace TooN {
+
+namespace Internal {
+
+/// The rotation nearest to a matrix in the Frobenius norm,
+/// \f$U\,\text{diag}(1, 1, \pm 1)V^\mathsf{T}\f$ from the SVD \f$M = UDV^\mathsf{T}\f$,
+/// with the sign chosen to give a determinant of one.
+template <typename Precision, typename Base>
+inline Matrix<3, 3, Precision> nearest_rotation(const Matrix<3, 3, Precision, Base>& m){
+	using std::abs;
+	GR_SVD<3, 3, Precision> svd(m);
+	Matrix<3, 3, Precision> u = svd.get_U();
+	const Matrix<3, 3, Precision>& v = svd.get_V();
+	if(((u[0] ^ u[1]) * u[2]) * ((v[0] ^ v[1]) * v[2]) < 0) {
+		//Flip the direction of the smallest singular value (they are not sorted)
+		const Vector<3, Precision>& d = svd.get_diagonal();
+		int smallest = 0;
+		for(int i=1; i < 3; i++)
+			if(abs(d[i]) < abs(d[smallest]))
+				smallest = i;
+		u.T()[smallest] *= -1;
+	}
+	return u * v.T();
+}
+
+/// A weight iterator which gives every element a weight of one
+template<typename Precision> struct UnitWeights {
+	Precision operator*() const { return 1; }
+	UnitWeights& operator++() { return *this; }
+};
+
+/// The mean of a range of elements of a group, which is only
+/// defined for the groups which mean() can average.
+template<class Group> struct Mean {};
+
+template<typename Precision> struct Mean<SO3<Precision> > {
+	typedef SO3<Precision> type;
+	typedef UnitWeights<Precision> Unit;
+
+	template<class Iterator, class WeightIterator>
+	static SO3<Precision> compute(Iterator begin, Iterator end, WeightIterator weights){
+		Matrix<3, 3, Precision> sum = Zeros;
+		Precision total = 0;
+		WeightIterator w = weights;
+		for(Iterator i = begin; i != end; ++i, ++w) {
+			sum += *w * i->get_matrix();
+			total += *w;
+		}
+		SO3<Precision> result(nearest_rotation(sum));
+
+		// Gauss-Newton on the sum of squared angles, approximating the Hessian by
+		// the identity. This converges linearly at a rate of about the square of
+		// the spread of the rotations, and the chordal mean is already close.
+		for(int iteration = 0; iteration < 10; iteration++) {
+			const SO3<Precision> inverse = result.inverse();
+			Vector<3, Precision> step = Zeros;
+			w = weights;
+			for(Iterator i = begin; i != end; ++i, ++w)
+				step += *w * (inverse * *i).ln();
+			step /= total;
+			result = result * SO3<Precision>::exp(step);
+			if(norm(step) <= 16 * std::numeric_limits<Precision>::epsilon())
+				break;
+		}
+		return result;
+	}
+};
+
+template<typename Precision> struct Mean<SE3<Precision> > {
+	typedef SE3<Precision> type;
+	typedef UnitWeights<Precision> Unit;
+
+	template<class Iterator, class WeightIterator>
+	static SE3<Precision> compute(Iterator begin, Iterator end, WeightIterator weights){
+		Matrix<3, 3, Precision> rotations = Zeros;
+		Vector<3, Precision> translations = Zeros;
+		Precision total = 0;
+		WeightIterator w = weights;
+		for(Iterator i = begin; i != end; ++i, ++w) {
+			rotations += *w * i->get_rotation().get_matrix();
+			translations += *w * i->get_translation();
+			total += *w;
+		}
+		SE3<Precision> result(SO3<Precision>(nearest_rotation(rotations)), translations / total);
+
+		for(int iteration = 0; iteration < 10; iteration++) {
+			const SE3<Precision> inverse = result.inverse();
+			Vector<6, Precision> step = Zeros;
+			w = weights;
+			for(Iterator i = begin; i != end; ++i, ++w)
+				step += *w * (inverse * *i).ln();
+			step /= total;
+			result *= SE3<Precision>::exp(step);
+			if(norm(step) <= 16 * std::numeric_limits<Precision>::epsilon())
+				break;
+		}
+		return result;
+	}
+};
+
+}
+
+/// Compute the weighted mean of a range of rotations or rigid transformations.
+/// For SO3 this is the rotation which minimises the weighted sum of squared
+/// angles to them, and for SE3 it is the transformation \f$T\f$ for which
+/// \f$\sum_i w_i\ln(T^{-1}T_i) = 0\f$. The closed form chordal mean, which
+/// takes the nearest rotation to the weighted sum of the rotation matrices and
+/// the weighted mean of the translations, is refined by a few Gauss-Newton
+/// steps. The rotations should all lie well within \f$\pi/2\f$ of each other,
+/// so that the mean is unique.
+/// @param begin The first element (a forward iterator to SO3 or SE3)
+/// @param end One past the last element
+/// @param weights An iterator to the weight of each element. The weights must have a positive sum.
+/// @ingroup gTransforms
+template<class Iterator, class WeightIterator>
+inline typename Internal::Mean<typename std::iterator_traits<Iterator>::value_type>::type mean(Iterator begin, Iterator end, WeightIterator weights){
+	return Internal::Mean<typename std::iterator_traits<Iterator>::value_type>::compute(begin, end, weights);
+}
+
+/// @overload
+/// All the elements have the same weight. The range must not be empty.
+/// @ingroup gTransforms
+template<class Iterator>
+inline typename Internal::Mean<typename std::iterator_traits<Iterator>::value_type>::type mean(Iterator begin, Iterator end){
+	typedef Internal::Mean<typename std::iterator_traits<Iterator>::value_type> Mean;
+	return Mean::compute(begin, end, typename Mean::Unit());
+}
+
+///A measurement of the relative rotation between two nodes of a pose graph,
+///used by chordal_rotation_averaging().
+///@ingroup gTransforms
+template<class Precision=DefaultPrecision> struct RelativeRotation
+{
+	int from;                   ///< The first node
+	int to;                     ///< The second node
+	SO3<Precision> rotation;    ///< The measured rotation, \f$R_\text{from}^{-1}R_\text{to}\f$
+	Precision weight;           ///< The weight of the measurement
+};
+
+/**
+Estimate the absolute rotations of the nodes of a pose graph from measurements
+of their relative rotations, for example to initialize a bundle adjustment or
+the calibration of a camera rig. This is the chordal relaxation: it minimises
+\f[ \sum_e w_e \| R_\text{to} - R_\text{from} R_e \|_F^2 \f]
+over all \f$3\times3\f$ matrices with \f$R_0 = I\f$, which is a sparse linear
+least squares problem solved with SparseCholesky, and then projects each
+matrix to the nearest rotation. The graph must be connected. Many
+measurements between the same pair of nodes may be given, and they are
+averaged in the same way as mean() initializes its estimate.
+@param nodes The number of nodes
+@param edges The relative rotation measurements
+@return The rotation of each node, with node 0 as the identity.
+@ingroup gTransforms
+**/
+template<class Precision>
+std::vector<SO3<Precision> > chordal_rotation_averaging(int nodes, const std::vector<RelativeRotation<Precision> >& edges)
+{
+	using std::sqrt;
+
+	//Each column k of R_i^T is unknown, and each edge gives the three
+	//equations R_to^T e_k = R_e^T R_from^T e_k. The first node is fixed,
+	//so its terms move to the right hand side.
+	const int unknowns = 3 * (nodes - 1);
+	std::vector<SparseEntry<Precision> > entries;
+	entries.reserve(edges.size() * 12);
+	Matrix<Dynamic, 3, Precision> rhs(3 * edges.size(), 3);
+	rhs = Zeros;
+
+	for(size_t e=0; e < edges.size(); e++)
+	{
+		const int row = 3 * e;
+		const Precision s = sqrt(edges[e].weight);
+		const Matrix<3, 3, Precision>& r = edges[e].rotation.get_matrix();
+
+		if(edges[e].to == 0)
+			rhs.template slice<3, 3>(row, 0) -= s * Matrix<3, 3, Precision>(Identity);
+		else
+			for(int i=0; i < 3; i++)
+				entries.push_back({row + i, 3 * (edges[e].to - 1) + i, s});
+
+		if(edges[e].from == 0)
+			rhs.template slice<3, 3>(row, 0) += s * r.T();
+		else
+			for(int i=0; i < 3; i++)
+				for(int j=0; j < 3; j++)
+					entries.push_back({row + i, 3 * (edges[e].from - 1) + j, -s * r(j, i)});
+	}
+
+	const SparseMatrix<Precision> J(3 * edges.size(), unknowns, entries);
+	const SparseMatrix<Precision> A = JtJ(J);
+
+	//The unknowns come in blocks of three with the same pattern, so the
+	//ordering is found on the much smaller graph of the nodes.
+	std::vector<SparseEntry<Precision> > links;
+	links.reserve(edges.size() * 2 + nodes);
+	for(int i=1; i < nodes; i++)
+		links.push_back({i - 1, i - 1, 1});
+	for(size_t e=0; e < edges.size(); e++)
+		if(edges[e].from != 0 && edges[e].to != 0)
+		{
+			links.push_back({edges[e].from - 1, edges[e].to - 1, 1});
+			links.push_back({edges[e].to - 1, edges[e].from - 1, 1});
+		}
+	const std::vector<int> node_order = Internal::minimum_degree_ordering(SparseMatrix<Precision>(nodes - 1, nodes - 1, links));
+	std::vector<int> order(unknowns);
+	for(int k=0; k < nodes - 1; k++)
+		for(int i=0; i < 3; i++)
+			order[3 * k + i] = 3 * node_order[k] + i;
+
+	SparseCholesky<Precision> chol;
+	chol.analyze(A, order);
+	chol.factorize(A);
+
+	std::vector<SO3<Precision> > rotations(nodes);
+	Matrix<Dynamic, 3, Precision> columns(unknowns, 3);
+	for(int k=0; k < 3; k++)
+		columns.T()[k] = chol.backsub(rhs.T()[k] * J);
+
+	for(int i=1; i < nodes; i++)
+		rotations[i] = SO3<Precision>(Internal::nearest_rotation(Matrix<3, 3, Precision>(columns.template slice<3, 3>(3 * (i - 1), 0).T())));
+
+	return rotations;
+}
+
+}
+
+#endif
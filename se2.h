@@ -101,15 +101,10 @@ public:
 	/// - 0 is translation in x
 	/// - 1 is translation in y
 	/// - 2 is rotation in the plane
-	static inline Matrix<3,3, Precision> generator(int i) {
-		Matrix<3,3,Precision> result(Zeros);
-		if(i < 2){
-			result[i][2] = 1;
-			return result;
-		}
-		result[0][1] = -1;
-		result[1][0] = 1;
-		return result;
+	static inline constexpr Matrix<3,3, Precision> generator(int i) {
+		return Data<Precision>(     0, -(i==2), (i==0),
+		                        (i==2),       0, (i==1),
+		                             0,       0,      0);
 	}
 
 	/// transfers a vector in the Lie algebra, from one coord frame to another
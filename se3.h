@@ -108,15 +108,13 @@ public:
 		return *this;
 	}
 
-	static inline Matrix<4,4,Precision> generator(int i){
-		Matrix<4,4,Precision> result(Zeros);
-		if(i < 3){
-			result[i][3]=1;
-			return result;
-		}
-		result[(i+1)%3][(i+2)%3] = -1;
-		result[(i+2)%3][(i+1)%3] = 1;
-		return result;
+	/// Returns the i-th generator: 0-2 are translations along x, y and z and
+	/// 3-5 are rotations about x, y and z. This can be used in constant expressions.
+	static inline constexpr Matrix<4,4,Precision> generator(int i){
+		return Data<Precision>(     0, -(i==5),  (i==4), (i==0),
+		                        (i==5),       0, -(i==3), (i==1),
+		                       -(i==4),  (i==3),       0, (i==2),
+		                             0,       0,       0,      0);
 	}
 
   /// Returns the i-th generator times pos
@@ -40,10 +40,243 @@ namespace TooN {
 template <int N, typename P> class SL;
 template <int N, typename P> std::istream & operator>>(std::istream &, SL<N, P> &);
 
+namespace Internal {
+	///@internal
+	///@brief Exponential of the traceless matrices and logarithm of the matrices
+	///in SL(N). In general, this uses TooN::exp and TooN::log, whose cost
+	///depends on the norm of the argument.
+	///@ingroup gInternal
+	template<int N, typename Precision> struct SLFunctions
+	{
+		static Matrix<N,N,Precision> exp(const Matrix<N,N,Precision>& a)
+		{
+			return TooN::exp(a);
+		}
+
+		static Matrix<N,N,Precision> log(const Matrix<N,N,Precision>& m)
+		{
+			return TooN::log(m);
+		}
+	};
+
+	///@internal
+	///@brief Closed forms for SL(2). A traceless 2x2 matrix \f$A\f$ has
+	///\f$A^2 = qI\f$ with \f$q = -\det A\f$, so \f$e^A = c I + s A\f$ where
+	///\f$c = \cosh\sqrt q\f$ and \f$s = \sinh \sqrt q / \sqrt q\f$ (or the
+	///trigonometric versions if \f$q < 0\f$).
+	///@ingroup gInternal
+	template<typename Precision> struct SLFunctions<2, Precision>
+	{
+		static Matrix<2,2,Precision> exp(const Matrix<2,2,Precision>& a)
+		{
+			using std::abs;
+			using std::sqrt;
+			using std::cos;
+			using std::sin;
+			using std::cosh;
+			using std::sinh;
+			const Precision q = a(0,0) * a(0,0) + a(0,1) * a(1,0);
+			Precision c, s;
+			if(abs(q) < 1e-6) {
+				c = 1 + q * (1.0/2 + q * (1.0/24 + q * (1.0/720)));
+				s = 1 + q * (1.0/6 + q * (1.0/120 + q * (1.0/5040)));
+			} else if(q > 0) {
+				const Precision x = sqrt(q);
+				c = cosh(x);
+				s = sinh(x) / x;
+			} else {
+				const Precision x = sqrt(-q);
+				c = cos(x);
+				s = sin(x) / x;
+			}
+			return TooN::Data(c + s * a(0,0), s * a(0,1), s * a(1,0), c + s * a(1,1));
+		}
+
+		///The logarithm is \f$f (M - hI)\f$, with \f$h = \frac{1}{2}\mathrm{tr} M\f$.
+		///\f$q = -\det(M - hI)\f$ gives the sine of the angle without the
+		///cancellation of computing it from the trace.
+		static Matrix<2,2,Precision> log(const Matrix<2,2,Precision>& m)
+		{
+			using std::abs;
+			using std::sqrt;
+			using std::atan2;
+			using std::asinh;
+			const Precision h = (m(0,0) + m(1,1)) / 2;
+			const Precision d = (m(0,0) - m(1,1)) / 2;
+			const Precision q = d * d + m(0,1) * m(1,0);
+			if(h <= 0 && q >= 0) //No real logarithm of this form
+				return TooN::log(m);
+			Precision f;
+			if(abs(q) < 1e-6 && h > 0)
+				f = 1 + q * (-1.0/6 + q * (3.0/40));
+			else if(q > 0)
+				f = asinh(sqrt(q)) / sqrt(q);
+			else
+				f = atan2(sqrt(-q), h) / sqrt(-q);
+			return TooN::Data(f * d, f * m(0,1), f * m(1,0), -f * d);
+		}
+	};
+
+	///@internal
+	///@brief Bounded cost exponential and logarithm for SL(3). These use
+	///the same approximants as TooN::exp and TooN::log, but always of the
+	///same order, with the 3x3 products and inverses written out.
+	///- exp is the [7/7] Pade approximant after scaling the 1-norm below
+	///  \f$\theta_7 = 0.95\f$. It costs 5 products and an inverse, plus one
+	///  product for each of at most max_squarings squarings.
+	///- log takes at most max_roots square roots, each of at most
+	///  max_iterations steps of the determinant scaled Denman and Beavers
+	///  iteration, until \f$\|M - I\|_1 \le 0.32\f$. It then evaluates the
+	///  [8/8] Pade approximant in partial fractions, which costs 8 inverses.
+	///  The iterates can be badly conditioned, so their inverses are found
+	///  by gaussian_elimination. The Pade denominators are close to the
+	///  identity, and use the adjugate.
+	///
+	///The closed forms of SL(2) would need the roots of the characteristic
+	///cubic here, which are badly conditioned near repeated eigenvalues.
+	///@ingroup gInternal
+	template<typename Precision> struct SLFunctions<3, Precision>
+	{
+		static const int max_squarings = 64;
+		static const int max_roots = 16;
+		static const int max_iterations = 16;
+
+		static Matrix<3,3,Precision> exp(const Matrix<3,3,Precision>& a)
+		{
+			using std::ceil;
+			using std::ldexp;
+			using std::log2;
+			const Precision norm = norm_1(a);
+			int squarings = 0;
+			if(norm > PadeExp::theta(2))
+				squarings = std::min(max_squarings, (int)ceil(log2(norm / PadeExp::theta(2))));
+
+			const Matrix<3,3,Precision> A = a * ldexp(Precision(1), -squarings);
+			const Matrix<3,3,Precision> A2 = multiply(A, A);
+			const Matrix<3,3,Precision> A4 = multiply(A2, A2);
+			const Matrix<3,3,Precision> A6 = multiply(A4, A2);
+
+			//U = A (b1 + b3 A^2 + b5 A^4 + b7 A^6), V = b0 + b2 A^2 + b4 A^4 + b6 A^6
+			const double* b = PadeExp::coefficients(2);
+			Matrix<3,3,Precision> W, V;
+			for(int r=0; r < 3; r++)
+				for(int c=0; c < 3; c++) {
+					W(r,c) = b[7] * A6(r,c) + b[5] * A4(r,c) + b[3] * A2(r,c);
+					V(r,c) = b[6] * A6(r,c) + b[4] * A4(r,c) + b[2] * A2(r,c);
+				}
+			for(int i=0; i < 3; i++) {
+				W(i,i) += b[1];
+				V(i,i) += b[0];
+			}
+			const Matrix<3,3,Precision> U = multiply(A, W);
+
+			//X = (V - U)^-1 (V + U)
+			Matrix<3,3,Precision> X = multiply(inverse(V - U), V + U);
+			for(int i=0; i < squarings; i++)
+				X = multiply(X, X);
+			return X;
+		}
+
+		static Matrix<3,3,Precision> log(const Matrix<3,3,Precision>& m)
+		{
+			using std::ldexp;
+			Matrix<3,3,Precision> A = m;
+			int roots = 0;
+			while(roots < max_roots && norm_1_minus_identity(A) > PadeLog::theta()) {
+				A = sqrt(A);
+				++roots;
+			}
+
+			//X = A - I, log(I + X) = sum_j w_j (I + x_j X)^-1 X
+			for(int i=0; i < 3; i++)
+				A(i,i) -= 1;
+			Matrix<3,3,Precision> result = Zeros;
+			for(int j=0; j < PadeLog::order; j++) {
+				Matrix<3,3,Precision> L = PadeLog::node(j) * A;
+				for(int i=0; i < 3; i++)
+					L(i,i) += 1;
+				result += PadeLog::weight(j) * multiply(inverse(L), A);
+			}
+			return result * ldexp(Precision(1), roots);
+		}
+
+	private:
+		///The product form of the Denman and Beavers iteration, with the
+		///determinant scaling of N. J. Higham, 'Functions of Matrices', 2008,
+		///section 6.3. It stops one step after \f$\|M - I\|_1\f$ falls below
+		///the square root of the machine precision.
+		static Matrix<3,3,Precision> sqrt(const Matrix<3,3,Precision>& a)
+		{
+			using std::abs;
+			using std::cbrt;
+			using std::sqrt;
+			const Precision tolerance = sqrt(std::numeric_limits<Precision>::epsilon());
+			const Matrix<3,3,Precision> I = TooN::Identity;
+			Matrix<3,3,Precision> M = a, Y = a;
+			bool last_step = false;
+			for(int i=0; i < max_iterations; i++) {
+				//mu = |det M|^(-1/6)
+				const Matrix<3,3,Precision> M_inv = gaussian_elimination(M, I);
+				const Precision mu2 = 1 / cbrt(abs(determinant(M)));
+				const Precision mu = sqrt(mu2);
+
+				//Y = mu Y (I + M^-1 / mu^2) / 2, M = (I + (mu^2 M + M^-1 / mu^2) / 2) / 2
+				Matrix<3,3,Precision> F;
+				for(int r=0; r < 3; r++)
+					for(int c=0; c < 3; c++) {
+						const Precision d = r == c ? 0.5 : 0;
+						F(r,c) = 0.5 * M_inv(r,c) / mu + mu * d;
+						M(r,c) = 0.25 * (mu2 * M(r,c) + M_inv(r,c) / mu2) + d;
+					}
+				Y = multiply(Y, F);
+
+				if(last_step)
+					break;
+				last_step = norm_1_minus_identity(M) <= tolerance;
+			}
+			return Y;
+		}
+
+		static Matrix<3,3,Precision> multiply(const Matrix<3,3,Precision>& a, const Matrix<3,3,Precision>& b)
+		{
+			Matrix<3,3,Precision> p;
+			for(int r=0; r < 3; r++)
+				for(int c=0; c < 3; c++)
+					p(r,c) = a(r,0) * b(0,c) + a(r,1) * b(1,c) + a(r,2) * b(2,c);
+			return p;
+		}
+
+		static Precision determinant(const Matrix<3,3,Precision>& m)
+		{
+			return m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1))
+			     + m(0,1) * (m(1,2) * m(2,0) - m(1,0) * m(2,2))
+			     + m(0,2) * (m(1,0) * m(2,1) - m(1,1) * m(2,0));
+		}
+
+		///The inverse from the adjugate.
+		static Matrix<3,3,Precision> inverse(const Matrix<3,3,Precision>& m)
+		{
+			Matrix<3,3,Precision> i;
+			i(0,0) = m(1,1) * m(2,2) - m(1,2) * m(2,1);
+			i(0,1) = m(0,2) * m(2,1) - m(0,1) * m(2,2);
+			i(0,2) = m(0,1) * m(1,2) - m(0,2) * m(1,1);
+			i(1,0) = m(1,2) * m(2,0) - m(1,0) * m(2,2);
+			i(1,1) = m(0,0) * m(2,2) - m(0,2) * m(2,0);
+			i(1,2) = m(0,2) * m(1,0) - m(0,0) * m(1,2);
+			i(2,0) = m(1,0) * m(2,1) - m(1,1) * m(2,0);
+			i(2,1) = m(0,1) * m(2,0) - m(0,0) * m(2,1);
+			i(2,2) = m(0,0) * m(1,1) - m(0,1) * m(1,0);
+			return i * (1 / (m(0,0) * i(0,0) + m(0,1) * i(1,0) + m(0,2) * i(2,0)));
+		}
+	};
+}
+
 /// represents an element from the group SL(n), the NxN matrices M with det(M) = 1.
 /// This can be used to conveniently estimate homographies on n-1 dimentional spaces.
 /// The implementation uses the matrix exponential function @ref exp for
 /// exponentiation from an element in the Lie algebra and LU to compute an inverse.
+/// SL<2> uses closed forms for the exponential and logarithm instead, and
+/// SL<3> uses fixed order approximants with a bounded cost.
 /// 
 /// The Lie algebra are the NxN matrices M with trace(M) = 0. The N*N-1 generators used
 /// to represent this vector space are the following:
@@ -96,6 +329,22 @@ public:
 	/// @arg i number of the generator between 0 and SL::dim -1 inclusive
 	static inline Matrix<N,N,Precision> generator(int);
 
+	/// returns the element of the Lie algebra with coordinates v, that is the
+	/// sum of generator(i) * v[i], without forming the generators.
+	/// @arg v a vector of dimension SL::dim
+	template <int S, typename P, typename B>
+	static inline Matrix<N,N,Precision> algebra(const Vector<S,P,B>& v);
+
+	/// returns generator(i) * pos, without forming the generator
+	template <int S, typename P, typename B>
+	static inline Vector<N,Precision> generator_field(int i, const Vector<S,P,B>& pos);
+
+	/// returns the Jacobian of the transformed point, the projection of
+	/// M (x, 1), with respect to v for the left update exp(v) * (*this) at v = 0.
+	/// @arg x a point in the N-1 dimensional space
+	template <int S, typename P, typename B>
+	inline Matrix<N-1,N*N-1,Precision> point_jacobian(const Vector<S,P,B>& x) const;
+
 private:
 	struct Invert {};
 	SL( const SL & from, struct Invert ) {
@@ -122,6 +371,17 @@ private:
 	static const int SYMM_LIMIT = COUNT_SYMM + DIAG_LIMIT;
 	///}
 
+	/// the row and column of the k-th pair of off-diagonal elements
+	static void off_diagonal(int k, int& row, int& col){
+		row = 0;
+		col = k + 1;
+		while(col > N - row - 1){
+			col -= N - row - 1;
+			++row;
+		}
+		col += row;
+	}
+
 	Matrix<N,N,Precision> my_matrix;
 };
 
@@ -129,17 +389,76 @@ template <int N, typename Precision>
 template <int S, typename P, typename B>
 inline SL<N, Precision> SL<N, Precision>::exp( const Vector<S,P,B> & v){
 	SizeMismatch<S,dim>::test(v.size(), dim);
-	Matrix<N,N,Precision> t(Zeros);
-	for(int i = 0; i < dim; ++i)
-		t += generator(i) * v[i];
 	SL<N, Precision> result;
-	result.my_matrix = TooN::exp(t);
+	result.my_matrix = Internal::SLFunctions<N, Precision>::exp(algebra(v));
+	return result;
+}
+
+template <int N, typename Precision>
+template <int S, typename P, typename B>
+inline Matrix<N,N,Precision> SL<N, Precision>::algebra( const Vector<S,P,B> & v){
+	SizeMismatch<S,dim>::test(v.size(), dim);
+	Matrix<N,N,Precision> result(Zeros);
+	for(int i = 0; i < DIAG_LIMIT; ++i){	// diagonal elements
+		result(i,i) += v[i];
+		result(i+1,i+1) -= v[i];
+	}
+	for(int i = DIAG_LIMIT, row = 0, col = 1; i < SYMM_LIMIT; ++i) {	// symmetric and antisymmetric in one go
+		result(row, col) = v[i] - v[i+COUNT_SYMM];
+		result(col, row) = v[i] + v[i+COUNT_SYMM];
+		++col;
+		if( col == N ){
+			++row;
+			col = row+1;
+		}
+	}
+	return result;
+}
+
+template <int N, typename Precision>
+template <int S, typename P, typename B>
+inline Vector<N,Precision> SL<N, Precision>::generator_field(int i, const Vector<S,P,B> & pos){
+	assert( i > -1 && i < dim );
+	SizeMismatch<S,N>::test(pos.size(), N);
+	Vector<N,Precision> result(Zeros);
+	int row, col;
+	if(i < DIAG_LIMIT) {
+		result[i] = pos[i];
+		result[i+1] = -pos[i+1];
+	} else if(i < SYMM_LIMIT){
+		off_diagonal(i - DIAG_LIMIT, row, col);
+		result[row] = pos[col];
+		result[col] = pos[row];
+	} else {
+		off_diagonal(i - SYMM_LIMIT, row, col);
+		result[row] = -pos[col];
+		result[col] = pos[row];
+	}
+	return result;
+}
+
+template <int N, typename Precision>
+template <int S, typename P, typename B>
+inline Matrix<N-1,N*N-1,Precision> SL<N, Precision>::point_jacobian( const Vector<S,P,B> & x) const {
+	SizeMismatch<S,N-1>::test(x.size(), N-1);
+	Vector<N,Precision> z = my_matrix.T()[N-1];
+	for(int r = 0; r < N; ++r)
+		for(int c = 0; c < N-1; ++c)
+			z[r] += my_matrix(r,c) * x[c];
+	const Precision inv = 1 / z[N-1];
+	Matrix<N-1,N*N-1,Precision> result;
+	for(int i = 0; i < dim; ++i){
+		// d/dv project(exp(v) z) = (w - project(z) w_N) / z_N, with w = generator(i) z
+		const Vector<N,Precision> w = generator_field(i, z);
+		for(int r = 0; r < N-1; ++r)
+			result(r,i) = (w[r] - z[r] * inv * w[N-1]) * inv;
+	}
 	return result;
 }
 
 template <int N, typename Precision>
 inline Vector<N*N-1, Precision> SL<N, Precision>::ln() const {
-	const Matrix<N> l = TooN::log(my_matrix);
+	const Matrix<N,N,Precision> l = Internal::SLFunctions<N, Precision>::log(my_matrix);
 	Vector<SL<N,Precision>::dim, Precision> v;
 	Precision last = 0;
 	for(int i = 0; i < DIAG_LIMIT; ++i){	// diagonal elements
@@ -167,20 +486,12 @@ inline Matrix<N,N,Precision> SL<N, Precision>::generator(int i){
 		result(i,i) = 1;
 		result(i+1,i+1) = -1;
 	} else if(i < SYMM_LIMIT){			// then the symmetric ones
-		int row = 0, col = i - DIAG_LIMIT + 1;
-		while(col > (N - row - 1)){
-			col -= (N - row - 1); 
-			++row;
-		}
-		col += row;
+		int row, col;
+		off_diagonal(i - DIAG_LIMIT, row, col);
 		result(row, col) = result(col, row) = 1;
 	} else {							// finally the antisymmetric ones
-		int row = 0, col = i - SYMM_LIMIT + 1;
-		while(col > N - row - 1){
-			col -= N - row - 1; 
-			++row;
-		}
-		col += row;
+		int row, col;
+		off_diagonal(i - SYMM_LIMIT, row, col);
 		result(row, col) = -1;
 		result(col, row) = 1;
 	}
@@ -117,11 +117,9 @@ public:
 	const Matrix<2,2,Precision>& get_matrix() const {return my_matrix;}
 
 	/// returns generator matrix
-	static Matrix<2,2,Precision> generator() {
-		Matrix<2,2,Precision> result;
-		result[0] = makeVector(0,-1);
-		result[1] = makeVector(1,0);
-		return result;
+	static constexpr Matrix<2,2,Precision> generator() {
+		return Data<Precision>(0, -1,
+		                       1,  0);
 	}
 
 private:
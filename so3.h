@@ -31,6 +31,7 @@
 #include <TooN/TooN.h>
 #include <TooN/helpers.h>
 #include <cassert>
+#include <limits>
 
 namespace TooN {
 
@@ -148,12 +149,11 @@ public:
 	/// Returns the i-th generator.  The generators of a Lie group are the basis
 	/// for the space of the Lie algebra.  For %SO3, the generators are three
 	/// \f$3\times3\f$ matrices representing the three possible (linearised)
-	/// rotations.
-	inline static Matrix<3,3, Precision> generator(int i){
-		Matrix<3,3,Precision> result(Zeros);
-		result[(i+1)%3][(i+2)%3] = -1;
-		result[(i+2)%3][(i+1)%3] = 1;
-		return result;
+	/// rotations. This can be used in constant expressions.
+	inline static constexpr Matrix<3,3, Precision> generator(int i){
+		return Data<Precision>(     0, -(i==2),  (i==1),
+		                        (i==2),       0, -(i==0),
+		                       -(i==1),  (i==0),       0);
 	}
 
   /// Returns the i-th generator times pos
@@ -0,0 +1,801 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+#ifndef TOON_INCLUDE_SPARSE_H
+#define TOON_INCLUDE_SPARSE_H
+
+#include <TooN/TooN.h>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+namespace TooN {
+
+///An element of a sparse matrix, used to build a SparseMatrix.
+///@ingroup gLinAlg
+template<class Precision=DefaultPrecision> struct SparseEntry
+{
+	int row;             ///< The row of the element
+	int col;             ///< The column of the element
+	Precision value;     ///< The value of the element
+};
+
+/**
+@class SparseMatrix
+A matrix in compressed sparse row (CSR) form: only the nonzero elements are
+stored, row by row, with the columns of each row in increasing order. The
+compressed sparse column form of a matrix is the CSR form of its transpose,
+which T() computes.
+
+A sparse matrix is built from a list of (row, column, value) entries. Entries
+with the same row and column are summed, so Jacobians can be assembled one
+term at a time:
+@code
+std::vector<SparseEntry<> > entries;
+for(...)
+	entries.push_back({measurement, parameter, derivative});
+SparseMatrix<> J(measurements, parameters, entries);
+
+Vector<> r = J * x;           //J x
+Vector<> g = e * J;           //J^T e
+SparseMatrix<> A = JtJ(J);    //J^T J
+@endcode
+The rows of a matrix-vector product are computed in parallel if OpenMP is
+enabled.
+@ingroup gLinAlg
+**/
+template<class Precision=DefaultPrecision>
+class SparseMatrix
+{
+	public:
+		///Construct an empty 0x0 matrix.
+		SparseMatrix()
+		:my_rows(0), my_cols(0), my_row_start(1, 0)
+		{}
+
+		///Construct a matrix from a list of entries. Entries with the same row
+		///and column are summed.
+		template<class P2>
+		SparseMatrix(int rows, int cols, const std::vector<SparseEntry<P2> >& entries)
+		:my_rows(rows), my_cols(cols), my_row_start(rows + 1, 0)
+		{
+			//Bucket the entries by row
+			for(size_t i=0; i < entries.size(); i++)
+			{
+				Internal::check_index(rows, entries[i].row);
+				Internal::check_index(cols, entries[i].col);
+				my_row_start[entries[i].row + 1]++;
+			}
+			for(int r=0; r < rows; r++)
+				my_row_start[r+1] += my_row_start[r];
+
+			std::vector<int> next(my_row_start.begin(), my_row_start.end() - 1);
+			std::vector<std::pair<int, Precision> > bucket(entries.size());
+			for(size_t i=0; i < entries.size(); i++)
+				bucket[next[entries[i].row]++] = std::make_pair(entries[i].col, Precision(entries[i].value));
+
+			//Sort each row and sum duplicates
+			my_columns.reserve(entries.size());
+			my_values.reserve(entries.size());
+			int start = 0;
+			for(int r=0; r < rows; r++)
+			{
+				const int end = my_row_start[r+1];
+				std::sort(bucket.begin() + start, bucket.begin() + end, compare_column);
+				my_row_start[r] = my_columns.size();
+				for(int i=start; i < end; i++)
+					if(i != start && bucket[i].first == bucket[i-1].first)
+						my_values.back() += bucket[i].second;
+					else
+					{
+						my_columns.push_back(bucket[i].first);
+						my_values.push_back(bucket[i].second);
+					}
+				start = end;
+			}
+			my_row_start[rows] = my_columns.size();
+		}
+
+		///Construct a matrix directly from CSR arrays. The columns in each row
+		///must be in increasing order.
+		SparseMatrix(int rows, int cols, const std::vector<int>& row_start, const std::vector<int>& columns, const std::vector<Precision>& values)
+		:my_rows(rows), my_cols(cols), my_row_start(row_start), my_columns(columns), my_values(values)
+		{
+			SizeMismatch<Dynamic, Dynamic>::test(rows + 1, row_start.size());
+			SizeMismatch<Dynamic, Dynamic>::test(columns.size(), values.size());
+		}
+
+		///Construct a sparse matrix from the nonzero elements of a dense one.
+		template<int R, int C, class P2, class B2>
+		explicit SparseMatrix(const Matrix<R, C, P2, B2>& m)
+		:my_rows(m.num_rows()), my_cols(m.num_cols()), my_row_start(1, 0)
+		{
+			for(int r=0; r < m.num_rows(); r++)
+			{
+				for(int c=0; c < m.num_cols(); c++)
+					if(m(r, c) != 0)
+					{
+						my_columns.push_back(c);
+						my_values.push_back(m(r, c));
+					}
+				my_row_start.push_back(my_columns.size());
+			}
+		}
+
+		///@name Access
+		///@{
+
+		///The number of rows.
+		int num_rows() const
+		{
+			return my_rows;
+		}
+
+		///The number of columns.
+		int num_cols() const
+		{
+			return my_cols;
+		}
+
+		///The number of stored elements.
+		int num_nonzeros() const
+		{
+			return my_columns.size();
+		}
+
+		///The index in to columns() and values() of the first element of each
+		///row, followed by num_nonzeros().
+		const std::vector<int>& row_start() const
+		{
+			return my_row_start;
+		}
+
+		///The column of each stored element.
+		const std::vector<int>& columns() const
+		{
+			return my_columns;
+		}
+
+		///The value of each stored element. The values may be changed freely
+		///without changing the structure of the matrix.
+		std::vector<Precision>& values()
+		{
+			return my_values;
+		}
+
+		///The value of each stored element.
+		const std::vector<Precision>& values() const
+		{
+			return my_values;
+		}
+
+		///Return element (r, c), which is zero if it is not stored. Run time
+		///is logarithmic in the number of elements in the row.
+		Precision operator()(int r, int c) const
+		{
+			Internal::check_index(num_rows(), r);
+			Internal::check_index(num_cols(), c);
+			const std::vector<int>::const_iterator b = my_columns.begin() + my_row_start[r], e = my_columns.begin() + my_row_start[r+1];
+			const std::vector<int>::const_iterator i = std::lower_bound(b, e, c);
+			if(i == e || *i != c)
+				return 0;
+			else
+				return my_values[i - my_columns.begin()];
+		}
+
+		///The transpose, which is also the compressed sparse column form of
+		///this matrix.
+		SparseMatrix T() const
+		{
+			SparseMatrix t;
+			t.my_rows = my_cols;
+			t.my_cols = my_rows;
+			t.my_row_start.assign(my_cols + 1, 0);
+			t.my_columns.resize(num_nonzeros());
+			t.my_values.resize(num_nonzeros());
+
+			for(int i=0; i < num_nonzeros(); i++)
+				t.my_row_start[my_columns[i] + 1]++;
+			for(int c=0; c < my_cols; c++)
+				t.my_row_start[c+1] += t.my_row_start[c];
+
+			//Rows are visited in order, so the columns of t come out sorted
+			std::vector<int> next(t.my_row_start.begin(), t.my_row_start.end() - 1);
+			for(int r=0; r < my_rows; r++)
+				for(int i=my_row_start[r]; i < my_row_start[r+1]; i++)
+				{
+					const int j = next[my_columns[i]]++;
+					t.my_columns[j] = r;
+					t.my_values[j] = my_values[i];
+				}
+			return t;
+		}
+
+		///Expand the matrix to a full matrix.
+		Matrix<Dynamic, Dynamic, Precision> dense() const
+		{
+			Matrix<Dynamic, Dynamic, Precision> m = Zeros(num_rows(), num_cols());
+			for(int r=0; r < my_rows; r++)
+				for(int i=my_row_start[r]; i < my_row_start[r+1]; i++)
+					m(r, my_columns[i]) = my_values[i];
+			return m;
+		}
+		///@}
+
+	private:
+		static bool compare_column(const std::pair<int, Precision>& a, const std::pair<int, Precision>& b)
+		{
+			return a.first < b.first;
+		}
+
+		int my_rows, my_cols;
+		std::vector<int> my_row_start;
+		std::vector<int> my_columns;
+		std::vector<Precision> my_values;
+};
+
+///Multiply a sparse matrix by a vector (SpMV). The rows are computed in
+///parallel if OpenMP is enabled.
+///@relates SparseMatrix
+template<class P1, int S, class P2, class B2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const SparseMatrix<P1>& m, const Vector<S, P2, B2>& v)
+{
+	SizeMismatch<Dynamic, S>::test(m.num_cols(), v.size());
+	TOON_INSTRUMENT_OPERATION("sparse * vector", 2.0*m.num_nonzeros());
+	typedef typename Internal::MultiplyType<P1, P2>::type P;
+	Vector<Dynamic, P> r(m.num_rows());
+	const int* row_start = &m.row_start()[0];
+	const int* columns = m.num_nonzeros() ? &m.columns()[0] : 0;
+	const P1* values = m.num_nonzeros() ? &m.values()[0] : 0;
+
+	#ifdef _OPENMP
+	#pragma omp parallel for if(m.num_nonzeros() > 10000)
+	#endif
+	for(int i=0; i < m.num_rows(); i++)
+	{
+		P s = 0;
+		for(int j=row_start[i]; j < row_start[i+1]; j++)
+			s += values[j] * v[columns[j]];
+		r[i] = s;
+	}
+	return r;
+}
+
+///Multiply a vector by a sparse matrix, which computes \f$A^\mathsf{T}v\f$
+///without forming the transpose. With OpenMP, large products are computed in
+///parallel, with one copy of the result per thread.
+///@relates SparseMatrix
+template<int S, class P1, class B1, class P2>
+Vector<Dynamic, typename Internal::MultiplyType<P1, P2>::type> operator*(const Vector<S, P1, B1>& v, const SparseMatrix<P2>& m)
+{
+	SizeMismatch<S, Dynamic>::test(v.size(), m.num_rows());
+	TOON_INSTRUMENT_OPERATION("vector * sparse", 2.0*m.num_nonzeros());
+	typedef typename Internal::MultiplyType<P1, P2>::type P;
+	Vector<Dynamic, P> r = Zeros(m.num_cols());
+	const int* row_start = &m.row_start()[0];
+	const int* columns = m.num_nonzeros() ? &m.columns()[0] : 0;
+	const P2* values = m.num_nonzeros() ? &m.values()[0] : 0;
+
+	#ifdef _OPENMP
+	//Each thread scatters a block of rows into its own copy of the result,
+	//and the copies are then summed a block of columns at a time.
+	const int threads = omp_get_max_threads();
+	if(m.num_nonzeros() > 10000 && threads > 1)
+	{
+		const int cols = m.num_cols();
+		std::vector<P> partial(static_cast<size_t>(threads) * cols, P(0));
+		#pragma omp parallel num_threads(threads)
+		{
+			P* mine = &partial[static_cast<size_t>(omp_get_thread_num()) * cols];
+			#pragma omp for
+			for(int i=0; i < m.num_rows(); i++)
+				for(int j=row_start[i]; j < row_start[i+1]; j++)
+					mine[columns[j]] += v[i] * values[j];
+
+			#pragma omp for
+			for(int c=0; c < cols; c++)
+			{
+				P s = 0;
+				for(int t=0; t < threads; t++)
+					s += partial[static_cast<size_t>(t) * cols + c];
+				r[c] = s;
+			}
+		}
+		return r;
+	}
+	#endif
+
+	for(int i=0; i < m.num_rows(); i++)
+		for(int j=row_start[i]; j < row_start[i+1]; j++)
+			r[columns[j]] += v[i] * values[j];
+	return r;
+}
+
+///Compute the sparse matrix \f$J^\mathsf{T}J\f$. Both triangles of the result
+///are stored, so it can be used directly by SparseCholesky.
+///@relates SparseMatrix
+template<class P>
+SparseMatrix<P> JtJ(const SparseMatrix<P>& J)
+{
+	const SparseMatrix<P> Jt = J.T();
+	const int n = J.num_cols();
+
+	std::vector<int> row_start(1, 0), columns;
+	std::vector<P> values;
+
+	//Row i of the result is the sum over k of J(k, i) * J(k, :). The row is
+	//accumulated in a dense workspace which only ever touches the nonzeros.
+	std::vector<P> work(n, 0);
+	std::vector<int> marker(n, -1), pattern;
+	for(int i=0; i < n; i++)
+	{
+		pattern.clear();
+		for(int a=Jt.row_start()[i]; a < Jt.row_start()[i+1]; a++)
+		{
+			const int k = Jt.columns()[a];
+			const P jki = Jt.values()[a];
+			for(int b=J.row_start()[k]; b < J.row_start()[k+1]; b++)
+			{
+				const int c = J.columns()[b];
+				if(marker[c] != i)
+				{
+					marker[c] = i;
+					pattern.push_back(c);
+					work[c] = 0;
+				}
+				work[c] += jki * J.values()[b];
+			}
+		}
+
+		std::sort(pattern.begin(), pattern.end());
+		for(size_t p=0; p < pattern.size(); p++)
+		{
+			columns.push_back(pattern[p]);
+			values.push_back(work[pattern[p]]);
+		}
+		row_start.push_back(columns.size());
+	}
+
+	TOON_INSTRUMENT_OPERATION("sparse JtJ", 2.0*columns.size());
+	return SparseMatrix<P>(n, n, row_start, columns, values);
+}
+
+namespace Internal
+{
+	///@internal
+	///Compute a fill reducing ordering of a symmetric sparse matrix by the
+	///approximate minimum degree (AMD) heuristic. Elimination is simulated on
+	///the quotient graph: an eliminated node becomes an element which stores
+	///its neighbours, instead of joining them into a clique, and elements
+	///inside a new element are absorbed into it. The degree of each node is
+	///bounded from above rather than computed exactly, which costs time in
+	///proportion to the size of the new element. The ordering is
+	///deterministic. perm[k] is the row of the matrix which is eliminated k'th.
+	///@ingroup gInternal
+	template<class P>
+	std::vector<int> minimum_degree_ordering(const SparseMatrix<P>& m)
+	{
+		const int n = m.num_rows();
+
+		//The nodes adjacent to each node, from both triangles
+		std::vector<std::vector<int> > adjacent(n);
+		for(int r=0; r < n; r++)
+			for(int i=m.row_start()[r]; i < m.row_start()[r+1]; i++)
+				if(m.columns()[i] != r)
+				{
+					adjacent[r].push_back(m.columns()[i]);
+					adjacent[m.columns()[i]].push_back(r);
+				}
+
+		//The elements adjacent to each node, and the nodes of each element
+		std::vector<std::vector<int> > elements(n), boundary(n);
+
+		//Each node is a variable, an element, or an element which has been absorbed
+		enum { variable, element, absorbed };
+		std::vector<char> state(n, variable);
+
+		//Variables are kept in doubly linked lists by degree
+		std::vector<int> degree(n), head(n, -1), next(n), prev(n);
+		for(int i=0; i < n; i++)
+		{
+			std::sort(adjacent[i].begin(), adjacent[i].end());
+			adjacent[i].erase(std::unique(adjacent[i].begin(), adjacent[i].end()), adjacent[i].end());
+			degree[i] = adjacent[i].size();
+		}
+
+		struct DegreeLists
+		{
+			std::vector<int>& degree, & head, & next, & prev;
+
+			void insert(int i)
+			{
+				next[i] = head[degree[i]];
+				prev[i] = -1;
+				if(head[degree[i]] != -1)
+					prev[head[degree[i]]] = i;
+				head[degree[i]] = i;
+			}
+
+			void remove(int i)
+			{
+				if(prev[i] != -1)
+					next[prev[i]] = next[i];
+				else
+					head[degree[i]] = next[i];
+				if(next[i] != -1)
+					prev[next[i]] = prev[i];
+			}
+		} lists = {degree, head, next, prev};
+
+		for(int i=n-1; i >= 0; i--)
+			lists.insert(i);
+
+		//mark[i] == k when variable i is in the k'th element. seen[e] == k when
+		//weight[e] holds the number of variables of element e outside it.
+		std::vector<int> mark(n, -1), seen(n, -1), weight(n, 0);
+		std::vector<int> perm;
+		perm.reserve(n);
+		int min_degree = 0;
+
+		for(int k=0; k < n; k++)
+		{
+			while(head[min_degree] == -1)
+				min_degree++;
+			const int p = head[min_degree];
+			lists.remove(p);
+			perm.push_back(p);
+
+			//The new element holds the neighbours of p, and absorbs the elements next to p
+			std::vector<int>& lp = boundary[p];
+			mark[p] = k;
+			for(size_t a=0; a < adjacent[p].size(); a++)
+			{
+				const int i = adjacent[p][a];
+				if(state[i] == variable && mark[i] != k)
+				{
+					mark[i] = k;
+					lp.push_back(i);
+				}
+			}
+			for(size_t a=0; a < elements[p].size(); a++)
+			{
+				const int e = elements[p][a];
+				if(state[e] != element)
+					continue;
+				for(size_t b=0; b < boundary[e].size(); b++)
+				{
+					const int i = boundary[e][b];
+					if(i != p && mark[i] != k)
+					{
+						mark[i] = k;
+						lp.push_back(i);
+					}
+				}
+				state[e] = absorbed;
+				std::vector<int>().swap(boundary[e]);
+			}
+			state[p] = element;
+			std::vector<int>().swap(adjacent[p]);
+			std::vector<int>().swap(elements[p]);
+
+			//Count the variables of each neighbouring element which are outside the new one
+			for(size_t a=0; a < lp.size(); a++)
+			{
+				const std::vector<int>& ei = elements[lp[a]];
+				for(size_t b=0; b < ei.size(); b++)
+				{
+					const int e = ei[b];
+					if(state[e] != element)
+						continue;
+					if(seen[e] != k)
+					{
+						seen[e] = k;
+						weight[e] = boundary[e].size();
+					}
+					weight[e]--;
+				}
+			}
+
+			//Update the variables of the new element
+			const int remaining = n - k - 1;
+			for(size_t a=0; a < lp.size(); a++)
+			{
+				const int i = lp[a];
+				lists.remove(i);
+
+				//Elements entirely inside the new one are absorbed
+				int external = 0;
+				std::vector<int>& ei = elements[i];
+				size_t kept = 0;
+				for(size_t b=0; b < ei.size(); b++)
+				{
+					const int e = ei[b];
+					if(state[e] != element)
+						continue;
+					if(weight[e] == 0)
+					{
+						state[e] = absorbed;
+						std::vector<int>().swap(boundary[e]);
+						continue;
+					}
+					external += weight[e];
+					ei[kept++] = e;
+				}
+				ei.resize(kept);
+				ei.push_back(p);
+
+				//Neighbours in the new element are reached through it
+				std::vector<int>& ai = adjacent[i];
+				kept = 0;
+				for(size_t b=0; b < ai.size(); b++)
+					if(state[ai[b]] == variable && mark[ai[b]] != k)
+						ai[kept++] = ai[b];
+				ai.resize(kept);
+
+				const int bound = ai.size() + external + lp.size() - 1;
+				degree[i] = std::min(std::min(bound, degree[i] + (int)lp.size() - 1), remaining - 1);
+				lists.insert(i);
+				min_degree = std::min(min_degree, degree[i]);
+			}
+		}
+		return perm;
+	}
+}
+
+/**
+Sparse \f$LDL^\mathsf{T}\f$ decomposition of a symmetric SparseMatrix, with
+a fill reducing ordering. Like Cholesky, the matrix need not be positive
+definite provided no pivot is zero. Both triangles of the matrix must be
+stored (as they are by JtJ()), and only the lower one is used.
+
+The decomposition is in two parts. analyze() computes the ordering and the
+structure of L from the nonzero pattern alone, and factorize() computes the
+values. When a sequence of matrices with the same pattern are solved, such
+as in each iteration of Gauss-Newton, analyze() need only be called once:
+@code
+SparseCholesky<> chol;
+chol.analyze(JtJ(J));
+for(...)
+{
+	SparseMatrix<> A = JtJ(J);  //same pattern, new values
+	chol.factorize(A);
+	Vector<> dx = chol.backsub(J.T() * e);
+}
+@endcode
+@ingroup gDecomps
+**/
+template<class Precision=DefaultPrecision>
+class SparseCholesky
+{
+	public:
+		///Construct an empty decomposition.
+		SparseCholesky()
+		:my_size(0), my_rank(0)
+		{}
+
+		///Construct the decomposition of a matrix.
+		template<class P2>
+		SparseCholesky(const SparseMatrix<P2>& m)
+		{
+			compute(m);
+		}
+
+		///Analyze and factorize a matrix.
+		template<class P2>
+		void compute(const SparseMatrix<P2>& m)
+		{
+			analyze(m);
+			factorize(m);
+		}
+
+		///Compute a minimum degree ordering for the matrix, and the structure
+		///of its decomposition.
+		template<class P2>
+		void analyze(const SparseMatrix<P2>& m)
+		{
+			analyze(m, Internal::minimum_degree_ordering(m));
+		}
+
+		///Compute the structure of the decomposition of a matrix, using the
+		///given ordering. perm[k] is the row of the matrix which is eliminated
+		///k'th.
+		template<class P2>
+		void analyze(const SparseMatrix<P2>& m, const std::vector<int>& perm)
+		{
+			SizeMismatch<Dynamic, Dynamic>::test(m.num_rows(), m.num_cols());
+			SizeMismatch<Dynamic, Dynamic>::test(m.num_rows(), perm.size());
+			TOON_INSTRUMENT_TIMED_OPERATION("Sparse Cholesky analyze", 0);
+
+			const int n = m.num_rows();
+			my_size = n;
+			my_rank = 0;
+			my_perm = perm;
+			my_inverse_perm.assign(n, 0);
+			for(int k=0; k < n; k++)
+				my_inverse_perm[perm[k]] = k;
+
+			//Compute the elimination tree and the number of elements in
+			//each column of L.
+			my_parent.assign(n, -1);
+			std::vector<int> flag(n), count(n, 0);
+			for(int k=0; k < n; k++)
+			{
+				flag[k] = k;
+				const int kk = perm[k];
+				for(int p=m.row_start()[kk]; p < m.row_start()[kk+1]; p++)
+					for(int i=my_inverse_perm[m.columns()[p]]; i < k && flag[i] != k; i = my_parent[i])
+					{
+						if(my_parent[i] == -1)
+							my_parent[i] = k;
+						count[i]++;
+						flag[i] = k;
+					}
+			}
+
+			my_column_start.assign(n + 1, 0);
+			for(int k=0; k < n; k++)
+				my_column_start[k+1] = my_column_start[k] + count[k];
+			my_rows.resize(my_column_start[n]);
+			my_values.resize(my_column_start[n]);
+			my_D.resize(n);
+		}
+
+		///Compute the decomposition of a matrix which has the same nonzero
+		///pattern as the one passed to analyze().
+		template<class P2>
+		void factorize(const SparseMatrix<P2>& m)
+		{
+			SizeMismatch<Dynamic, Dynamic>::test(m.num_rows(), my_size);
+			const int n = my_size;
+			TOON_INSTRUMENT_TIMED_OPERATION("Sparse Cholesky factorize", 0);
+
+			std::vector<Precision> y(n, 0);
+			std::vector<int> flag(n), count(n, 0), pattern(n);
+
+			//Up-looking decomposition: row k of L is found by solving with the
+			//rows above it, following the elimination tree to find its pattern.
+			for(int k=0; k < n; k++)
+			{
+				int top = n;
+				flag[k] = k;
+				const int kk = my_perm[k];
+				for(int p=m.row_start()[kk]; p < m.row_start()[kk+1]; p++)
+				{
+					int i = my_inverse_perm[m.columns()[p]];
+					if(i <= k)
+					{
+						y[i] += m.values()[p];
+						int len = 0;
+						for(; flag[i] != k; i = my_parent[i])
+						{
+							pattern[len++] = i;
+							flag[i] = k;
+						}
+						while(len > 0)
+							pattern[--top] = pattern[--len];
+					}
+				}
+
+				my_D[k] = y[k];
+				y[k] = 0;
+				for(; top < n; top++)
+				{
+					const int i = pattern[top];
+					const Precision yi = y[i];
+					y[i] = 0;
+					const int end = my_column_start[i] + count[i];
+					for(int p=my_column_start[i]; p < end; p++)
+						y[my_rows[p]] -= my_values[p] * yi;
+					const Precision l = yi / my_D[i];
+					my_D[k] -= l * yi;
+					my_rows[end] = k;
+					my_values[end] = l;
+					count[i]++;
+				}
+
+				if(my_D[k] == 0)
+				{
+					my_rank = k;
+					return;
+				}
+			}
+			my_rank = n;
+		}
+
+		///Compute \f$M^{-1}v\f$.
+		template<int S, class P2, class B2>
+		Vector<Dynamic, Precision> backsub(const Vector<S, P2, B2>& v) const
+		{
+			SizeMismatch<Dynamic, S>::test(my_size, v.size());
+			const int n = my_size;
+			Vector<Dynamic, Precision> x(n);
+			for(int k=0; k < n; k++)
+				x[k] = v[my_perm[k]];
+
+			//backsub through L
+			for(int j=0; j < n; j++)
+				for(int p=my_column_start[j]; p < my_column_start[j+1]; p++)
+					x[my_rows[p]] -= my_values[p] * x[j];
+
+			//backsub through D
+			for(int j=0; j < n; j++)
+				x[j] /= my_D[j];
+
+			//backsub through L^T
+			for(int j=n-1; j >= 0; j--)
+				for(int p=my_column_start[j]; p < my_column_start[j+1]; p++)
+					x[j] -= my_values[p] * x[my_rows[p]];
+
+			Vector<Dynamic, Precision> r(n);
+			for(int k=0; k < n; k++)
+				r[my_perm[k]] = x[k];
+			return r;
+		}
+
+		///Compute the determinant.
+		Precision determinant() const
+		{
+			Precision d = 1;
+			for(int i=0; i < my_size; i++)
+				d *= my_D[i];
+			return d;
+		}
+
+		///The number of nonzero pivots found before the decomposition stopped.
+		int rank() const
+		{
+			return my_rank;
+		}
+
+		///The ordering used: perm[k] is the row of the matrix which was
+		///eliminated k'th.
+		const std::vector<int>& get_permutation() const
+		{
+			return my_perm;
+		}
+
+		///The number of elements stored below the diagonal of L.
+		int num_nonzeros() const
+		{
+			return my_rows.size();
+		}
+
+	private:
+		int my_size;
+		int my_rank;
+		std::vector<int> my_perm, my_inverse_perm;
+		std::vector<int> my_parent;
+		std::vector<int> my_column_start, my_rows;
+		std::vector<Precision> my_values, my_D;
+};
+
+}
+
+#endif
@@ -0,0 +1,353 @@
+// -*- c++ -*-
+
+// Copyright (C) 2009 Tom Drummond (twd20@cam.ac.uk),
+// Ed Rosten (er258@cam.ac.uk)
+
+//All rights reserved.
+//
+//Redistribution and use in source and binary forms, with or without
+//modification, are permitted provided that the following conditions
+//are met:
+//1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//2. Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the distribution.
+//
+//THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND OTHER CONTRIBUTORS ``AS IS''
+//AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR OTHER CONTRIBUTORS BE
+//LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+//SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+//INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TOON_INCLUDE_SPLINE_H
+#define TOON_INCLUDE_SPLINE_H
+
+#include <TooN/so3.h>
+#include <TooN/se3.h>
+#include <TooN/sim3.h>
+#include <TooN/helpers.h>
+#include <TooN/gaussian_elimination.h>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+namespace TooN {
+
+namespace Internal {
+
+	/// The dimension of the Lie algebra of a transformation group
+	/// and its bracket, \f$[a, b]\f$, in the tangent space parameterisation
+	/// used by the group's exp() and ln().
+	template<class Group> struct LieGroupTraits;
+
+	template<typename P> struct LieGroupTraits<SO3<P> > {
+		static const int dim = 3;
+		typedef P Precision;
+
+		static Vector<3, P> bracket(const Vector<3, P>& a, const Vector<3, P>& b) {
+			return a ^ b;
+		}
+	};
+
+	template<typename P> struct LieGroupTraits<SE3<P> > {
+		static const int dim = 6;
+		typedef P Precision;
+
+		static Vector<6, P> bracket(const Vector<6, P>& a, const Vector<6, P>& b) {
+			Vector<6, P> result;
+			result.template slice<0,3>() = (a.template slice<3,3>() ^ b.template slice<0,3>()) - (b.template slice<3,3>() ^ a.template slice<0,3>());
+			result.template slice<3,3>() = a.template slice<3,3>() ^ b.template slice<3,3>();
+			return result;
+		}
+	};
+
+	template<typename P> struct LieGroupTraits<SIM3<P> > {
+		static const int dim = 7;
+		typedef P Precision;
+
+		static Vector<7, P> bracket(const Vector<7, P>& a, const Vector<7, P>& b) {
+			Vector<7, P> result;
+			result.template slice<0,3>() = (a.template slice<3,3>() ^ b.template slice<0,3>()) - (b.template slice<3,3>() ^ a.template slice<0,3>())
+			                             + a[6] * b.template slice<0,3>() - b[6] * a.template slice<0,3>();
+			result.template slice<3,3>() = a.template slice<3,3>() ^ b.template slice<3,3>();
+			result[6] = 0;
+			return result;
+		}
+	};
+
+	/// The matrix of the adjoint of a group element, so that
+	/// adjoint_matrix(g) * v == g.adjoint(v)
+	template<class Group>
+	Matrix<LieGroupTraits<Group>::dim, LieGroupTraits<Group>::dim, typename LieGroupTraits<Group>::Precision> adjoint_matrix(const Group& g)
+	{
+		static const int dim = LieGroupTraits<Group>::dim;
+		typedef typename LieGroupTraits<Group>::Precision P;
+		Matrix<dim, dim, P> result;
+		for(int i=0; i < dim; i++) {
+			Vector<dim, P> e = Zeros;
+			e[i] = 1;
+			result.T()[i] = g.adjoint(e);
+		}
+		return result;
+	}
+
+	/// The right Jacobian of exp, \f$J_r(x)\f$, so that
+	/// \f$\exp(x + \delta) \approx \exp(x)\exp(J_r(x)\delta)\f$. It is the series
+	/// \f$\sum_k (-\text{ad}_x)^k/(k+1)!\f$, which is summed directly when
+	/// \f$\|\text{ad}_x\|_1 \le 1\f$. Otherwise it is the top right block of
+	/// \f$\exp\begin{bmatrix}-\text{ad}_x & I\\ 0 & 0\end{bmatrix}\f$.
+	template<class Group>
+	Matrix<LieGroupTraits<Group>::dim, LieGroupTraits<Group>::dim, typename LieGroupTraits<Group>::Precision> right_jacobian(const Vector<LieGroupTraits<Group>::dim, typename LieGroupTraits<Group>::Precision>& x)
+	{
+		static const int dim = LieGroupTraits<Group>::dim;
+		typedef typename LieGroupTraits<Group>::Precision P;
+		Matrix<dim, dim, P> ad;
+		for(int i=0; i < dim; i++) {
+			Vector<dim, P> e = Zeros;
+			e[i] = 1;
+			ad.T()[i] = -LieGroupTraits<Group>::bracket(x, e);
+		}
+
+		if(norm_1(ad) <= 1) {
+			//The terms are bounded by 1/(k+1)!, so this converges in under 20 terms
+			Matrix<dim, dim, P> result = TooN::Identity;
+			Matrix<dim, dim, P> term = TooN::Identity;
+			for(int k=1; k < 24; k++) {
+				term = term * ad / P(k+1);
+				result += term;
+				if(norm_inf(term) <= std::numeric_limits<P>::epsilon())
+					break;
+			}
+			return result;
+		}
+
+		Matrix<2*dim, 2*dim, P> m = Zeros;
+		m.template slice<0, 0, dim, dim>() = ad;
+		m.template slice<0, dim, dim, dim>() = TooN::Identity;
+		MatrixExponential<2*dim, P> exponential;
+		return exponential.compute(m).template slice<0, dim, dim, dim>();
+	}
+}
+
+/// Geodesic interpolation between two transformations,
+/// \f$a\exp(t\ln(a^{-1}b))\f$, so that t=0 gives a and t=1 gives b.
+/// This works for SO3, SE3 and SIM3.
+/// @ingroup gTransforms
+template<class Group>
+inline Group interpolate(const Group& a, const Group& b, const typename Internal::LieGroupTraits<Group>::Precision& t)
+{
+	return a * Group::exp(t * (a.inverse() * b).ln());
+}
+
+/// A uniform cumulative cubic B-spline trajectory on a Lie group (SO3, SE3
+/// or SIM3). Control pose \f$P_i\f$ sits at time \f$t_0 + i\Delta t\f$, and
+/// segment \f$i\f$, which covers \f$[t_0 + i\Delta t, t_0 + (i+1)\Delta t)\f$,
+/// is
+/// \f[ T(u) = P_{i-1} \prod_{j=1}^{3} \exp\left(\tilde{B}_j(u)\,\Omega_{i-1+j}\right),\quad \Omega_k = \ln(P_{k-1}^{-1}P_k), \f]
+/// where \f$u = (t - t_0)/\Delta t - i\f$ and \f$\tilde{B}_j\f$ are the
+/// cumulative basis functions. Each segment depends on the control poses
+/// on either side of it, so the spline is defined from the second control
+/// pose to the second last one, and passes close to the control poses
+/// at their times (through them if they lie on a geodesic). The trajectory
+/// is \f$C^2\f$, so it has continuous velocity and acceleration, which
+/// makes it suitable for rolling shutter and inertial sensor models.
+///
+/// The \f$\Omega_k\f$ are computed when the control poses are set, and the
+/// basis is evaluated from its polynomial coefficients, so that evaluating a
+/// pose costs three exponentials and three compositions. Velocities and
+/// accelerations are in the body frame: \f$T^{-1}\dot{T} = \hat{v}\f$.
+/// Times outside \f$[t_0 + \Delta t, t_0 + (n-2)\Delta t]\f$, where n is the
+/// number of control poses, are extrapolated from the first or last segment.
+/// @code
+/// CumulativeSpline<SE3<> > trajectory(frame_start, row_time * 100);
+/// for(int i=0; i < poses.size(); i++)
+///     trajectory.push_back(poses[i]);
+///
+/// std::vector<SE3<> > row_poses;
+/// trajectory.evaluate(row_times, row_poses);
+/// @endcode
+/// @ingroup gTransforms
+template<class Group>
+class CumulativeSpline {
+public:
+	/// The dimension of the tangent space
+	static const int dim = Internal::LieGroupTraits<Group>::dim;
+	typedef typename Internal::LieGroupTraits<Group>::Precision Precision;
+
+	/// Construct an empty spline.
+	/// @param start The time of the first control pose
+	/// @param interval The time between control poses
+	CumulativeSpline(Precision start=0, Precision interval=1)
+	:my_start(start), my_interval(interval)
+	{}
+
+	/// Append a control pose.
+	void push_back(const Group& control) {
+		my_controls.push_back(control);
+		my_omega.push_back(Vector<dim, Precision>(Zeros));
+		update(my_controls.size() - 1);
+	}
+
+	/// Replace control pose i.
+	void set_control(int i, const Group& control) {
+		my_controls[i] = control;
+		update(i);
+		if(i + 1 < size())
+			update(i + 1);
+	}
+
+	/// Return control pose i
+	const Group& get_control(int i) const { return my_controls[i]; }
+
+	/// Return the number of control poses
+	int size() const { return my_controls.size(); }
+
+	/// Return the time at which the spline starts, which is the time of the
+	/// second control pose.
+	Precision get_start_time() const { return my_start + my_interval; }
+
+	/// Return the time between control poses
+	Precision get_interval() const { return my_interval; }
+
+	/// Return the time at which the spline ends, which is the time of the
+	/// second last control pose.
+	Precision get_end_time() const { return my_start + (size() - 2) * my_interval; }
+
+	/// Return the first control pose used to evaluate time t. The pose at
+	/// time t depends on control poses segment(t) to segment(t)+3, so
+	/// segment(t)+1 is the segment containing t.
+	int segment(Precision t) const {
+		assert(size() >= 4);
+		const int last = size() - 4;
+		const Precision s = std::floor((t - my_start) / my_interval) - 1;
+		if(s <= 0)
+			return 0;
+		else if(s >= last)
+			return last;
+		else
+			return static_cast<int>(s);
+	}
+
+	/// Evaluate the pose at time t.
+	Group pose(Precision t) const {
+		const int i = segment(t);
+		Vector<3, Precision> b, db, ddb;
+		basis((t - my_start) / my_interval - (i + 1), b, db, ddb);
+
+		Group result = my_controls[i];
+		for(int j=0; j < 3; j++)
+			result *= Group::exp(b[j] * my_omega[i+j+1]);
+		return result;
+	}
+
+	/// Evaluate the body frame velocity at time t.
+	Vector<dim, Precision> velocity(Precision t) const {
+		Group p;
+		Vector<dim, Precision> v, a;
+		evaluate(t, p, v, a);
+		return v;
+	}
+
+	/// Evaluate the body frame acceleration at time t.
+	Vector<dim, Precision> acceleration(Precision t) const {
+		Group p;
+		Vector<dim, Precision> v, a;
+		evaluate(t, p, v, a);
+		return a;
+	}
+
+	/// Evaluate the pose, body frame velocity and acceleration at time t in a single pass.
+	void evaluate(Precision t, Group& pose, Vector<dim, Precision>& velocity, Vector<dim, Precision>& acceleration) const {
+		const int i = segment(t);
+		Vector<3, Precision> b, db, ddb;
+		basis((t - my_start) / my_interval - (i + 1), b, db, ddb);
+		db /= my_interval;
+		ddb /= my_interval * my_interval;
+
+		pose = my_controls[i];
+		velocity = Zeros;
+		acceleration = Zeros;
+		for(int j=0; j < 3; j++) {
+			const Vector<dim, Precision>& omega = my_omega[i+j+1];
+			const Group a_inv = Group::exp(-b[j] * omega);
+			const Vector<dim, Precision> dw = db[j] * omega;
+			pose *= a_inv.inverse();
+			velocity = a_inv.adjoint(velocity) + dw;
+			acceleration = a_inv.adjoint(acceleration) + Internal::LieGroupTraits<Group>::bracket(velocity, dw) + ddb[j] * omega;
+		}
+	}
+
+	/// Evaluate the poses at many times, for example one per image row for
+	/// rolling shutter correction. poses is resized to match times, and its
+	/// storage is reused between calls.
+	template<int S, typename B>
+	void evaluate(const Vector<S, Precision, B>& times, std::vector<Group>& poses) const {
+		poses.resize(times.size());
+		for(int n=0; n < times.size(); n++)
+			poses[n] = pose(times[n]);
+	}
+
+	/// The Jacobian of the pose at time t with respect to the control poses
+	/// segment(t) to segment(t)+3. Column block m is the derivative of
+	/// \f$\ln(T^{-1}T')\f$, where \f$T'\f$ is the pose after control pose
+	/// segment(t)+m is perturbed to \f$P\exp(\delta)\f$.
+	Matrix<dim, 4*dim, Precision> pose_jacobian(Precision t) const {
+		const int i = segment(t);
+		Vector<3, Precision> b, db, ddb;
+		basis((t - my_start) / my_interval - (i + 1), b, db, ddb);
+
+		Matrix<dim, 4*dim, Precision> jacobian = Zeros;
+		Group rest;  //The product of the factors to the right of factor j
+		for(int j=3; j > 0; j--) {
+			const Vector<dim, Precision>& omega = my_omega[i+j];
+			const Vector<dim, Precision> scaled = b[j-1] * omega;
+			const Matrix<dim, dim, Precision> right_inverse = gaussian_elimination(Internal::right_jacobian<Group>(omega), Matrix<dim, dim, Precision>(Identity));
+			const Matrix<dim, dim, Precision> k = b[j-1] * Internal::adjoint_matrix(rest.inverse()) * Internal::right_jacobian<Group>(scaled) * right_inverse;
+
+			jacobian.slice(0, j*dim, dim, dim) += k;
+			jacobian.slice(0, (j-1)*dim, dim, dim) -= k * Internal::adjoint_matrix(Group::exp(-omega));
+			rest = Group::exp(scaled) * rest;
+		}
+		jacobian.slice(0, 0, dim, dim) += Internal::adjoint_matrix(rest.inverse());
+		return jacobian;
+	}
+
+private:
+	// Recompute the relative motion into control pose i
+	void update(int i) {
+		if(i > 0)
+			my_omega[i] = (my_controls[i-1].inverse() * my_controls[i]).ln();
+	}
+
+	// The cumulative cubic B-spline basis and its derivatives with respect to u
+	static void basis(Precision u, Vector<3, Precision>& b, Vector<3, Precision>& db, Vector<3, Precision>& ddb) {
+		const Precision u2 = u*u;
+		const Precision u3 = u2*u;
+		b[0] = (5 + 3*u - 3*u2 + u3) / 6;
+		b[1] = (1 + 3*u + 3*u2 - 2*u3) / 6;
+		b[2] = u3 / 6;
+		db[0] = (1 - 2*u + u2) / 2;
+		db[1] = (1 + 2*u - 2*u2) / 2;
+		db[2] = u2 / 2;
+		ddb[0] = u - 1;
+		ddb[1] = 1 - 2*u;
+		ddb[2] = u;
+	}
+
+	Precision my_start;
+	Precision my_interval;
+	std::vector<Group> my_controls;
+	std::vector<Vector<dim, Precision> > my_omega;
+};
+
+}
+
+#endif
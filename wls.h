@@ -39,10 +39,10 @@ namespace TooN {
 /// Performs Gauss-Newton weighted least squares computation.
 /// @param Size The number of dimensions in the system
 /// @param Precision The numerical precision used (double, float etc)
-/// @param Decomposition The class used to invert the inverse Covariance matrix (must have one integer size and one typename precision template arguments) this is Cholesky by default, but could also be SQSVD
+/// @param Decomposition The class used to invert the inverse Covariance matrix (must have one integer size and one typename precision template arguments, and may have further defaulted ones) this is Cholesky by default, but could also be SQSVD
 /// @ingroup gEquations
 template <int Size=Dynamic, class Precision=DefaultPrecision,
-		  template<int DecompSize, class DecompPrecision> class Decomposition = Cholesky>
+		  template<int DecompSize, class DecompPrecision, class... DecompOptions> class Decomposition = Cholesky>
 class WLS {
 public:
 
@@ -163,8 +163,8 @@ public:
 					   const Matrix<N,N,P3,B3>& invcov){
 		const Matrix<S1,N,Precision> temp1 = J1.T() * invcov;
 		const int size1 = J1.num_cols();
-		my_C_inv.slice(index1, index1, size1, size1) += temp1 * J1;
-		my_vector.slice(index1, size1) += temp1 * m;
+		my_C_inv.template slice<Dynamic, Dynamic, S1, S1>(index1, index1, size1, size1) += temp1 * J1;
+		my_vector.template slice<Dynamic, S1>(index1, size1) += temp1 * m;
 	}
 
 	/// Add multiple measurements at once with a sparse Jacobian (much, much more efficiently)
@@ -184,17 +184,18 @@ public:
 		const Matrix<S1,S2,Precision> mixed = temp1 * J2;
 		const int size1 = J1.num_cols();
 		const int size2 = J2.num_cols();
-		my_C_inv.slice(index1, index1, size1, size1) += temp1 * J1;
-		my_C_inv.slice(index2, index2, size2, size2) += temp2 * J2;
-		my_C_inv.slice(index1, index2, size1, size2) += mixed;
-		my_C_inv.slice(index2, index1, size2, size1) += mixed.T();
-		my_vector.slice(index1, size1) += temp1 * m;
-		my_vector.slice(index2, size2) += temp2 * m;
+		my_C_inv.template slice<Dynamic, Dynamic, S1, S1>(index1, index1, size1, size1) += temp1 * J1;
+		my_C_inv.template slice<Dynamic, Dynamic, S2, S2>(index2, index2, size2, size2) += temp2 * J2;
+		my_C_inv.template slice<Dynamic, Dynamic, S1, S2>(index1, index2, size1, size2) += mixed;
+		my_C_inv.template slice<Dynamic, Dynamic, S2, S1>(index2, index1, size2, size1) += mixed.T();
+		my_vector.template slice<Dynamic, S1>(index1, size1) += temp1 * m;
+		my_vector.template slice<Dynamic, S2>(index2, size2) += temp2 * m;
 	}
 
 	/// Process all the measurements and compute the weighted least squares set of parameter values
 	/// stores the result internally which can then be accessed by calling get_mu()
 	void compute(){
+		TOON_INSTRUMENT_TIMED_OPERATION("WLS", 0);
 	
 		//Copy the upper right triangle to the empty lower-left.
 		for(int r=1; r < my_C_inv.num_rows(); r++)